@@ -1,8 +1,154 @@
 #pragma once
 
+#include "iterator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+#define FT_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
 namespace ft {
+	// Comparison kernels for contiguous ranges of arithmetic types.
+	// _mismatch_* return the first index where the elements differ by
+	// operator== (n if none). Integers are equal exactly when their bytes
+	// are, floats use ordered compares so 0.0 == -0.0 and NaN != NaN.
+	// AVX2 versions are picked at runtime, SSE2 is part of x86-64.
+
+	template<typename T>
+	std::size_t _mismatch_scalar(const T* a, const T* b, std::size_t i, std::size_t n) {
+		for (; i < n; ++i)
+			if (!(a[i] == b[i]))
+				return i;
+		return n;
+	}
+
+#ifdef FT_SIMD_X86
+	inline bool _cpu_has_avx2() {
+		static const bool has_avx2 = __builtin_cpu_supports("avx2");
+		return has_avx2;
+	}
+
+	inline std::size_t _mismatch_bytes_sse2(const unsigned char* a, const unsigned char* b, std::size_t i, std::size_t n) {
+		for (; i + 16 <= n; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+			unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+			if (mask != 0xFFFFu)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_scalar(a, b, i, n);
+	}
+
+	__attribute__((target("avx2")))
+	inline std::size_t _mismatch_bytes_avx2(const unsigned char* a, const unsigned char* b, std::size_t n) {
+		std::size_t i = 0;
+		for (; i + 32 <= n; i += 32) {
+			__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+			__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+			unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+			if (mask != 0xFFFFFFFFu)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_bytes_sse2(a, b, i, n);
+	}
+
+	inline std::size_t _mismatch_float_sse2(const float* a, const float* b, std::size_t i, std::size_t n) {
+		for (; i + 4 <= n; i += 4) {
+			unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))));
+			if (mask != 0xFu)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_scalar(a, b, i, n);
+	}
+
+	__attribute__((target("avx2")))
+	inline std::size_t _mismatch_float_avx2(const float* a, const float* b, std::size_t n) {
+		std::size_t i = 0;
+		for (; i + 8 <= n; i += 8) {
+			unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ)));
+			if (mask != 0xFFu)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_float_sse2(a, b, i, n);
+	}
+
+	inline std::size_t _mismatch_double_sse2(const double* a, const double* b, std::size_t i, std::size_t n) {
+		for (; i + 2 <= n; i += 2) {
+			unsigned int mask = static_cast<unsigned int>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i))));
+			if (mask != 0x3u)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_scalar(a, b, i, n);
+	}
+
+	__attribute__((target("avx2")))
+	inline std::size_t _mismatch_double_avx2(const double* a, const double* b, std::size_t n) {
+		std::size_t i = 0;
+		for (; i + 4 <= n; i += 4) {
+			unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ)));
+			if (mask != 0xFu)
+				return i + __builtin_ctz(~mask);
+		}
+		return ft::_mismatch_double_sse2(a, b, i, n);
+	}
+#endif
+
+	inline std::size_t _mismatch_bytes(const unsigned char* a, const unsigned char* b, std::size_t n) {
+	#ifdef FT_SIMD_X86
+		if (ft::_cpu_has_avx2())
+			return ft::_mismatch_bytes_avx2(a, b, n);
+		return ft::_mismatch_bytes_sse2(a, b, 0, n);
+	#else
+		return ft::_mismatch_scalar(a, b, 0, n);
+	#endif
+	}
+
+	template<typename T>
+	std::size_t _mismatch(const T* a, const T* b, std::size_t n, ft::true_type) {
+		return ft::_mismatch_bytes(reinterpret_cast<const unsigned char*>(a), reinterpret_cast<const unsigned char*>(b), n * sizeof(T)) / sizeof(T);
+	}
+
+	template<typename T>
+	std::size_t _mismatch(const T* a, const T* b, std::size_t n, ft::false_type) {
+		return ft::_mismatch_scalar(a, b, 0, n);
+	}
+
+#ifdef FT_SIMD_X86
+	inline std::size_t _mismatch(const float* a, const float* b, std::size_t n, ft::false_type) {
+		if (ft::_cpu_has_avx2())
+			return ft::_mismatch_float_avx2(a, b, n);
+		return ft::_mismatch_float_sse2(a, b, 0, n);
+	}
+
+	inline std::size_t _mismatch(const double* a, const double* b, std::size_t n, ft::false_type) {
+		if (ft::_cpu_has_avx2())
+			return ft::_mismatch_double_avx2(a, b, n);
+		return ft::_mismatch_double_sse2(a, b, 0, n);
+	}
+#endif
+
+	template<typename T>
+	std::size_t _mismatch(const T* a, const T* b, std::size_t n) {
+		return ft::_mismatch(a, b, n, ft::is_integral<T>());
+	}
+
+	// Both iterators are raw pointers to the same arithmetic type
+	template<typename Iterator1, typename Iterator2>
+	struct _is_simd_comparable : public integral_constant<bool,
+		ft::is_contiguous_iterator<Iterator1>::value && ft::is_contiguous_iterator<Iterator2>::value
+		&& ft::are_same<typename ft::unwrapped_iterator<Iterator1>::type, Iterator1>::value
+		&& ft::are_same<typename ft::unwrapped_iterator<Iterator2>::type, Iterator2>::value
+		&& ft::are_same<typename ft::iterator_traits<Iterator1>::value_type, typename ft::iterator_traits<Iterator2>::value_type>::value
+		&& ft::is_arithmetic<typename ft::iterator_traits<Iterator1>::value_type>::value> {};
+
 	template<typename InputIterator1, typename InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+	bool _equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, ft::false_type) {
 		for (; first1 != last1; ++first1, ++first2)
 			if (*first1 != *first2)
 				return false;
@@ -10,7 +156,7 @@ namespace ft {
 	}
 
 	template<typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
-	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred) {
+	bool _equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred) {
 		for (; first1 != last1; ++first1, ++first2)
 			if (!pred(*first1, *first2))
 				return false;
@@ -18,7 +164,7 @@ namespace ft {
 	}
 
 	template<typename InputIterator1, typename InputIterator2>
-	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2) {
+	bool _lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, ft::false_type) {
 		for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
 			if (*first2 < *first1)
 				return false;
@@ -29,7 +175,7 @@ namespace ft {
 	}
 
 	template<typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
-	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, BinaryPredicate pred) {
+	bool _lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, BinaryPredicate pred) {
 		for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
 			if (pred(*first2, *first1))
 				return false;
@@ -38,4 +184,356 @@ namespace ft {
 		}
 		return first2 != last2;
 	}
+
+	/**
+	 * @brief equal over arithmetic arrays, integers are compared with
+	 * memcmp and floats with the SIMD kernels
+	 */
+	template<typename Pointer1, typename Pointer2>
+	bool _equal(Pointer1 first1, Pointer1 last1, Pointer2 first2, ft::true_type) {
+		typedef typename ft::iterator_traits<Pointer1>::value_type value_type;
+		std::size_t n = last1 - first1;
+		if (ft::is_integral<value_type>::value)
+			return n == 0 || std::memcmp(first1, first2, n * sizeof(value_type)) == 0;
+		return ft::_mismatch<value_type>(first1, first2, n) == n;
+	}
+
+	/**
+	 * @brief lexicographical_compare over arithmetic arrays, memcmp for
+	 * unsigned bytes, otherwise the SIMD kernels skip the common prefix and
+	 * only the first mismatch is compared with operator<
+	 * @note A mismatch where neither element is less (NaN) is skipped like
+	 * the element loop does.
+	 */
+	template<typename Pointer1, typename Pointer2>
+	bool _lexicographical_compare(Pointer1 first1, Pointer1 last1, Pointer2 first2, Pointer2 last2, ft::true_type) {
+		typedef typename ft::iterator_traits<Pointer1>::value_type value_type;
+		std::size_t n1 = last1 - first1;
+		std::size_t n2 = last2 - first2;
+		std::size_t n = n1 < n2 ? n1 : n2;
+		if (ft::are_same<value_type, unsigned char>::value) {
+			int cmp = n == 0 ? 0 : std::memcmp(first1, first2, n);
+			return cmp != 0 ? cmp < 0 : n1 < n2;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			i += ft::_mismatch<value_type>(first1 + i, first2 + i, n - i);
+			if (i == n)
+				break;
+			if (first2[i] < first1[i])
+				return false;
+			if (first1[i] < first2[i])
+				return true;
+		}
+		return n1 < n2;
+	}
+
+	// The public algorithms unwrap contiguous iterators (see
+	// ft::unwrap_iterator), arithmetic arrays then take the kernels above
+
+	template<typename InputIterator1, typename InputIterator2>
+	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+		typedef typename ft::unwrapped_iterator<InputIterator1>::type iterator1;
+		typedef typename ft::unwrapped_iterator<InputIterator2>::type iterator2;
+		return ft::_equal(ft::unwrap_iterator(first1), ft::unwrap_iterator(last1), ft::unwrap_iterator(first2),
+			ft::integral_constant<bool, ft::_is_simd_comparable<iterator1, iterator2>::value>());
+	}
+
+	template<typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred) {
+		return ft::_equal(ft::unwrap_iterator(first1), ft::unwrap_iterator(last1), ft::unwrap_iterator(first2), pred);
+	}
+
+	template<typename InputIterator1, typename InputIterator2>
+	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2) {
+		typedef typename ft::unwrapped_iterator<InputIterator1>::type iterator1;
+		typedef typename ft::unwrapped_iterator<InputIterator2>::type iterator2;
+		return ft::_lexicographical_compare(ft::unwrap_iterator(first1), ft::unwrap_iterator(last1),
+			ft::unwrap_iterator(first2), ft::unwrap_iterator(last2), ft::integral_constant<bool, ft::_is_simd_comparable<iterator1, iterator2>::value>());
+	}
+
+	template<typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, BinaryPredicate pred) {
+		return ft::_lexicographical_compare(ft::unwrap_iterator(first1), ft::unwrap_iterator(last1),
+			ft::unwrap_iterator(first2), ft::unwrap_iterator(last2), pred);
+	}
+
+	/**
+	 * @brief Number of online cpus, used when a worker count of 0 is given
+	 */
+	inline std::size_t hardware_concurrency() {
+		long n = sysconf(_SC_NPROCESSORS_ONLN);
+		return n > 0 ? static_cast<std::size_t>(n) : 1;
+	}
+
+	// Calls a comparator through a pointer so tasks don't need to copy or
+	// default construct it
+	template<typename Compare>
+	struct _compare_ref {
+		const Compare* comp;
+
+		_compare_ref(const Compare* c) : comp(c) {}
+
+		template<typename T1, typename T2>
+		bool operator()(const T1& x, const T2& y) const {
+			return (*this->comp)(x, y);
+		}
+	};
+
+	template<typename RandomIterator, typename Compare>
+	struct _sort_task {
+		RandomIterator first;
+		RandomIterator middle;
+		RandomIterator last;
+		const Compare* comp;
+
+		static void* sort(void* arg) {
+			_sort_task* task = static_cast<_sort_task*>(arg);
+			std::stable_sort(task->first, task->last, _compare_ref<Compare>(task->comp));
+			return NULL;
+		}
+
+		static void* merge(void* arg) {
+			_sort_task* task = static_cast<_sort_task*>(arg);
+			std::inplace_merge(task->first, task->middle, task->last, _compare_ref<Compare>(task->comp));
+			return NULL;
+		}
+	};
+
+	/**
+	 * @brief Run count tasks, each on its own thread except the first one
+	 * which runs on the caller. A task whose thread can't be created
+	 * runs on the caller as well.
+	 */
+	template<typename Task>
+	void _run_tasks(Task* tasks, std::size_t count, void* (*fn)(void*)) {
+		pthread_t* threads = new pthread_t[count];
+		bool* started = new bool[count];
+		for (std::size_t i = 1; i < count; ++i)
+			started[i] = pthread_create(&threads[i], NULL, fn, &tasks[i]) == 0;
+		fn(&tasks[0]);
+		for (std::size_t i = 1; i < count; ++i) {
+			if (started[i])
+				pthread_join(threads[i], NULL);
+			else
+				fn(&tasks[i]);
+		}
+		delete[] started;
+		delete[] threads;
+	}
+
+	/**
+	 * @brief Stable sort of [first, last) split over several threads.
+	 * Every worker stable sorts one chunk, then neighbour chunks are merged
+	 * pairwise (in parallel too) until one run is left.
+	 * @param workers number of threads to use, 0 for one per cpu
+	 * @note comp must not throw, it runs on worker threads.
+	 */
+	template<typename RandomIterator, typename Compare>
+	void parallel_stable_sort(RandomIterator first, RandomIterator last, Compare comp, std::size_t workers = 0) {
+		typedef _sort_task<RandomIterator, Compare> task_type;
+		const std::size_t min_chunk = 4096;
+
+		std::size_t n = last - first;
+		if (workers == 0)
+			workers = ft::hardware_concurrency();
+		std::size_t chunks = std::min(workers, n / min_chunk);
+		if (chunks <= 1) {
+			std::stable_sort(first, last, comp);
+			return;
+		}
+
+		RandomIterator* bounds = new RandomIterator[chunks + 1];
+		task_type* tasks = new task_type[chunks];
+		for (std::size_t i = 0; i <= chunks; ++i)
+			bounds[i] = first + (n * i / chunks);
+		for (std::size_t i = 0; i < chunks; ++i) {
+			tasks[i].first = bounds[i];
+			tasks[i].last = bounds[i + 1];
+			tasks[i].comp = &comp;
+		}
+		ft::_run_tasks(tasks, chunks, &task_type::sort);
+
+		for (std::size_t width = 1; width < chunks; width *= 2) {
+			std::size_t count = 0;
+			for (std::size_t i = 0; i + width < chunks; i += 2 * width, ++count) {
+				tasks[count].first = bounds[i];
+				tasks[count].middle = bounds[i + width];
+				tasks[count].last = bounds[std::min(i + 2 * width, chunks)];
+				tasks[count].comp = &comp;
+			}
+			ft::_run_tasks(tasks, count, &task_type::merge);
+		}
+		delete[] tasks;
+		delete[] bounds;
+	}
+
+	// Bulk copy/fill of trivially copyable arrays, split over threads once
+	// big enough (see set_bulk_parallelism). Chunk boundaries are page
+	// addresses (see _bulk_boundary), each page is written by one thread
+	// only, so fresh memory is also first-touched in parallel.
+
+	template<typename Dummy = void>
+	struct _bulk_parallelism {
+		static std::size_t workers;
+		static std::size_t min_bytes;
+	};
+
+	template<typename Dummy>
+	std::size_t _bulk_parallelism<Dummy>::workers = 1;
+
+	template<typename Dummy>
+	std::size_t _bulk_parallelism<Dummy>::min_bytes = 64 * 1024 * 1024;
+
+	/**
+	 * @brief Let vector fill and copy trivially copyable arrays of at least
+	 * min_bytes on workers threads (assign, growth, copy).
+	 * @param workers number of threads, 0 for one per cpu, 1 turns it off
+	 * (default)
+	 * @note Meant to be set once at startup, it is not synchronized.
+	 */
+	inline void set_bulk_parallelism(std::size_t workers, std::size_t min_bytes = 64 * 1024 * 1024) {
+		_bulk_parallelism<>::workers = workers == 0 ? ft::hardware_concurrency() : workers;
+		_bulk_parallelism<>::min_bytes = min_bytes;
+	}
+
+	/**
+	 * @brief Number of chunks to split bytes into, 1 when it should stay on
+	 * the calling thread
+	 */
+	inline std::size_t _bulk_chunks(std::size_t bytes) {
+		const std::size_t page_size = 4096;
+		std::size_t workers = _bulk_parallelism<>::workers;
+		if (workers <= 1 || bytes < _bulk_parallelism<>::min_bytes)
+			return 1;
+		return std::max<std::size_t>(1, std::min(workers, bytes / page_size));
+	}
+
+	/**
+	 * @brief Offset from dest of the end of chunk i (from 1) when bytes are
+	 * split into chunk_bytes pieces, a multiple of the page size. The first
+	 * chunk also takes the head up to the first page boundary, so every
+	 * boundary is a page address whatever dest's alignment.
+	 */
+	inline std::size_t _bulk_boundary(const void* dest, std::size_t chunk_bytes, std::size_t i, std::size_t bytes) {
+		const std::size_t page_size = 4096;
+		std::size_t head = (page_size - reinterpret_cast<std::size_t>(dest) % page_size) % page_size;
+		return std::min(bytes, head + i * chunk_bytes);
+	}
+
+	struct _copy_task {
+		void* dest;
+		const void* src;
+		std::size_t bytes;
+
+		static void* run(void* arg) {
+			_copy_task* task = static_cast<_copy_task*>(arg);
+			std::memcpy(task->dest, task->src, task->bytes);
+			return NULL;
+		}
+	};
+
+	template<typename T>
+	struct _fill_task {
+		T* dest;
+		std::size_t n;
+		const T* val;
+
+		static void* run(void* arg) {
+			_fill_task* task = static_cast<_fill_task*>(arg);
+			std::fill_n(task->dest, task->n, *task->val);
+			return NULL;
+		}
+	};
+
+	/**
+	 * @brief memcpy, in parallel chunks ending on dest's page boundaries
+	 * when large enough
+	 * @note dest and src must not overlap.
+	 */
+	inline void _bulk_copy(void* dest, const void* src, std::size_t bytes) {
+		const std::size_t page_size = 4096;
+		std::size_t chunks = ft::_bulk_chunks(bytes);
+		if (chunks <= 1) {
+			std::memcpy(dest, src, bytes);
+			return;
+		}
+		std::size_t chunk_bytes = (bytes / chunks + page_size - 1) / page_size * page_size;
+		_copy_task* tasks = new _copy_task[chunks];
+		std::size_t count = 0;
+		for (std::size_t offset = 0; offset < bytes; ++count) {
+			std::size_t end = ft::_bulk_boundary(dest, chunk_bytes, count + 1, bytes);
+			tasks[count].dest = static_cast<char*>(dest) + offset;
+			tasks[count].src = static_cast<const char*>(src) + offset;
+			tasks[count].bytes = end - offset;
+			offset = end;
+		}
+		ft::_run_tasks(tasks, count, &_copy_task::run);
+		delete[] tasks;
+	}
+
+	/**
+	 * @brief std::fill_n of a trivially copyable T, in parallel chunks when
+	 * large enough. Boundaries are dest's page boundaries rounded up to a
+	 * whole element.
+	 */
+	template<typename T>
+	void _bulk_fill(T* dest, std::size_t n, const T& val) {
+		const std::size_t page_size = 4096;
+		std::size_t chunks = ft::_bulk_chunks(n * sizeof(T));
+		if (chunks <= 1) {
+			std::fill_n(dest, n, val);
+			return;
+		}
+		std::size_t bytes = n * sizeof(T);
+		std::size_t chunk_bytes = (bytes / chunks + page_size - 1) / page_size * page_size;
+		_fill_task<T>* tasks = new _fill_task<T>[chunks];
+		std::size_t count = 0;
+		for (std::size_t offset = 0; offset < n; ++count) {
+			std::size_t end = (ft::_bulk_boundary(dest, chunk_bytes, count + 1, bytes) + sizeof(T) - 1) / sizeof(T);
+			tasks[count].dest = dest + offset;
+			tasks[count].n = end - offset;
+			tasks[count].val = &val;
+			offset = end;
+		}
+		ft::_run_tasks(tasks, count, &_fill_task<T>::run);
+		delete[] tasks;
+	}
+
+	/**
+	 * @brief std::rotate(first, middle, last) where [middle, last) was just
+	 * appended to a container and moves in front of [first, middle).
+	 * Trivially copyable elements are not swapped one by one: the appended
+	 * ones are saved in a buffer, [first, middle) is shifted with one
+	 * memmove and the buffer is copied back. The buffer lives on the stack
+	 * up to 4KB and comes from alloc above that.
+	 * @exception bad_alloc from alloc, nothing is moved then
+	 */
+	template<typename T, typename Allocator>
+	void _rotate_appended(T* first, T* middle, T* last, Allocator& alloc, ft::true_type) {
+		char stack_buffer[4096];
+		std::size_t n = last - middle;
+		std::size_t bytes = n * sizeof(T);
+		T* heap_buffer = NULL;
+		void* buffer = stack_buffer;
+		if (bytes > sizeof(stack_buffer)) {
+			heap_buffer = alloc.allocate(n);
+			buffer = heap_buffer;
+		}
+		std::memcpy(buffer, static_cast<const void*>(middle), bytes);
+		std::memmove(static_cast<void*>(first + n), static_cast<const void*>(first), (middle - first) * sizeof(T));
+		std::memcpy(static_cast<void*>(first), buffer, bytes);
+		if (heap_buffer != NULL)
+			alloc.deallocate(heap_buffer, n);
+	}
+
+	template<typename T, typename Allocator>
+	void _rotate_appended(T* first, T* middle, T* last, Allocator& alloc, ft::false_type) {
+		(void)alloc;
+		std::rotate(first, middle, last);
+	}
+
+	template<typename T, typename Allocator>
+	void _rotate_appended(T* first, T* middle, T* last, Allocator& alloc) {
+		ft::_rotate_appended(first, middle, last, alloc, ft::is_trivially_copyable<T>());
+	}
 }
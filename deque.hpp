@@ -0,0 +1,553 @@
+#pragma once
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+
+namespace ft {
+	/**
+	 * @brief Double ended queue stored as a map of fixed-size blocks
+	 * (deque_block_size<T>() elements each).
+	 * push/pop at both ends are O(1) and never move elements, growing only
+	 * reallocates the block map, so references to elements stay valid.
+	 * @note insert/erase in the middle shift the shorter side.
+	 */
+	template< typename T, typename Allocator = std::allocator<T> >
+	class deque {
+	public:
+		typedef T													value_type;
+		typedef Allocator											allocator_type;
+		typedef typename Allocator::reference						reference;
+		typedef typename Allocator::const_reference					const_reference;
+		typedef typename Allocator::pointer							pointer;
+		typedef typename Allocator::const_pointer					const_pointer;
+		typedef ft::deque_iterator<pointer, value_type>				iterator;
+		typedef ft::deque_iterator<const_pointer, value_type>		const_iterator;
+		typedef ft::rai_reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::rai_reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t										difference_type;
+		typedef std::size_t											size_type;
+
+	private:
+		typedef typename iterator::map_pointer						map_pointer;
+		typedef typename Allocator::template rebind<pointer>::other	map_allocator_type;
+
+	public:
+		// construct/copy/destroy
+
+		/**
+		 * @brief Creates a deque with no elements.
+		 * @param alloc An allocator object.
+		 */
+		explicit deque(const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_map(0),
+			_map_size(0) {
+			this->initialize_map();
+		}
+
+		/**
+		 * @brief Creates a deque with n copies of val.
+		 */
+		explicit deque(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_map(0),
+			_map_size(0) {
+			this->initialize_map();
+			try {
+				this->insert(this->end(), n, val);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		/**
+		 * @brief Builds a deque from a range [first, last).
+		 */
+		template<typename InputIterator>
+		deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::iterator_traits<InputIterator>::iterator_category* = 0) :
+			_allocator(alloc),
+			_map(0),
+			_map_size(0) {
+			this->initialize_map();
+			try {
+				for (; first != last; ++first)
+					this->push_back(*first);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		deque(const deque& x) :
+			_allocator(x.get_allocator()),
+			_map(0),
+			_map_size(0) {
+			this->initialize_map();
+			try {
+				for (const_iterator it = x.begin(); it != x.end(); ++it)
+					this->push_back(*it);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		~deque() {
+			this->release();
+		}
+
+		deque& operator=(const deque& x) {
+			if (&x == this) return *this;
+			this->assign(x.begin(), x.end());
+			return *this;
+		}
+
+		// iterators
+
+		iterator begin() {
+			return this->_start;
+		}
+
+		const_iterator begin() const {
+			return const_iterator(this->_start);
+		}
+
+		iterator end() {
+			return this->_finish;
+		}
+
+		const_iterator end() const {
+			return const_iterator(this->_finish);
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(this->begin());
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_finish - this->_start;
+		}
+
+		size_type max_size() const {
+			return this->get_allocator().max_size();
+		}
+
+		void resize(size_type n, value_type val = value_type()) {
+			size_type len = this->size();
+			if (n < len)
+				this->erase(this->begin() + n, this->end());
+			else if (n > len)
+				this->insert(this->end(), n - len, val);
+		}
+
+		bool empty() const {
+			return this->_finish == this->_start;
+		}
+
+		// element access
+
+		reference operator[](size_type n) {
+			return this->_start[n];
+		}
+
+		const_reference operator[](size_type n) const {
+			return this->_start[n];
+		}
+
+		reference at(size_type n) {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return this->_start[n];
+		}
+
+		const_reference at(size_type n) const {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return this->_start[n];
+		}
+
+		reference front() {
+			return *this->_start;
+		}
+
+		const_reference front() const {
+			return *this->_start;
+		}
+
+		reference back() {
+			return *(this->_finish - 1);
+		}
+
+		const_reference back() const {
+			return *(this->_finish - 1);
+		}
+
+		// modifiers
+
+		template<typename InputIterator>
+		void assign(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			iterator current = this->begin();
+			for (; first != last && current != this->end(); ++first, ++current)
+				*current = *first;
+			if (first == last)
+				this->erase(current, this->end());
+			else
+				this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type& val) {
+			size_type len = this->size();
+			if (n > len) {
+				std::fill(this->begin(), this->end(), val);
+				this->insert(this->end(), n - len, val);
+			} else {
+				this->erase(this->begin() + n, this->end());
+				std::fill(this->begin(), this->end(), val);
+			}
+		}
+
+		/**
+		 * @brief Add val at the end, a new block is linked in when the last
+		 * one is full. Strong guarantee.
+		 */
+		void push_back(const value_type& val) {
+			if (this->_finish.base() != this->_finish.last() - 1) {
+				this->_allocator.construct(this->_finish.base(), val);
+				this->_finish.setCur(this->_finish.base() + 1);
+				return;
+			}
+			this->reserve_map_at_back(1);
+			*(this->_finish.node() + 1) = this->allocate_block();
+			try {
+				this->_allocator.construct(this->_finish.base(), val);
+			} catch (...) {
+				this->deallocate_block(*(this->_finish.node() + 1));
+				throw;
+			}
+			this->_finish.setNode(this->_finish.node() + 1);
+			this->_finish.setCur(this->_finish.first());
+		}
+
+		/**
+		 * @brief Add val at the front, a new block is linked in when the first
+		 * one is full. Strong guarantee.
+		 */
+		void push_front(const value_type& val) {
+			if (this->_start.base() != this->_start.first()) {
+				this->_allocator.construct(this->_start.base() - 1, val);
+				this->_start.setCur(this->_start.base() - 1);
+				return;
+			}
+			this->reserve_map_at_front(1);
+			*(this->_start.node() - 1) = this->allocate_block();
+			try {
+				this->_allocator.construct(*(this->_start.node() - 1) + ft::deque_block_size<value_type>() - 1, val);
+			} catch (...) {
+				this->deallocate_block(*(this->_start.node() - 1));
+				throw;
+			}
+			this->_start.setNode(this->_start.node() - 1);
+			this->_start.setCur(this->_start.last() - 1);
+		}
+
+		void pop_back() {
+			if (this->_finish.base() == this->_finish.first()) {
+				this->deallocate_block(this->_finish.first());
+				this->_finish.setNode(this->_finish.node() - 1);
+				this->_finish.setCur(this->_finish.last());
+			}
+			this->_finish.setCur(this->_finish.base() - 1);
+			this->_allocator.destroy(this->_finish.base());
+		}
+
+		void pop_front() {
+			this->_allocator.destroy(this->_start.base());
+			if (this->_start.base() != this->_start.last() - 1) {
+				this->_start.setCur(this->_start.base() + 1);
+			} else {
+				this->deallocate_block(this->_start.first());
+				this->_start.setNode(this->_start.node() + 1);
+				this->_start.setCur(this->_start.first());
+			}
+		}
+
+		iterator insert(iterator position, const value_type& val) {
+			size_type position_idx = position - this->begin();
+			this->insert(position, size_type(1), val);
+			return this->begin() + position_idx;
+		}
+
+		/**
+		 * @brief Fill insert, the new elements are pushed on the end closer to
+		 * position then rotated in place
+		 */
+		void insert(iterator position, size_type n, const value_type& val) {
+			if (n == 0) return;
+			value_type copy(val);
+			size_type position_idx = position - this->begin();
+			bool at_front = position_idx < this->size() / 2;
+			size_type pushed = 0;
+			try {
+				for (; pushed < n; ++pushed) {
+					if (at_front)
+						this->push_front(copy);
+					else
+						this->push_back(copy);
+				}
+			} catch (...) {
+				this->unpush(pushed, at_front);
+				throw;
+			}
+			this->rotate_in(position_idx, n, at_front);
+		}
+
+		/**
+		 * @brief Range insert, like the fill insert the range is pushed on the
+		 * end closer to position then rotated in place
+		 */
+		template<typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			size_type position_idx = position - this->begin();
+			bool at_front = position_idx < this->size() / 2;
+			size_type pushed = 0;
+			try {
+				for (; first != last; ++first, ++pushed) {
+					if (at_front)
+						this->push_front(*first);
+					else
+						this->push_back(*first);
+				}
+			} catch (...) {
+				this->unpush(pushed, at_front);
+				throw;
+			}
+			if (at_front)
+				std::reverse(this->begin(), this->begin() + pushed);
+			this->rotate_in(position_idx, pushed, at_front);
+		}
+
+		iterator erase(iterator position) {
+			return this->erase(position, position + 1);
+		}
+
+		/**
+		 * @brief Erase [first, last), the shorter side is shifted over the gap
+		 * and the leftover is popped
+		 */
+		iterator erase(iterator first, iterator last) {
+			if (first == last) return first;
+			size_type n = last - first;
+			size_type elems_before = first - this->begin();
+			if (elems_before < (this->size() - n) / 2) {
+				std::copy_backward(this->begin(), first, last);
+				for (; n > 0; --n)
+					this->pop_front();
+			} else {
+				std::copy(last, this->end(), first);
+				for (; n > 0; --n)
+					this->pop_back();
+			}
+			return this->begin() + elems_before;
+		}
+
+		void swap(deque& x) {
+			if (this == &x) return;
+			std::swap(this->_map, x._map);
+			std::swap(this->_map_size, x._map_size);
+			std::swap(this->_start, x._start);
+			std::swap(this->_finish, x._finish);
+		}
+
+		/**
+		 * @brief Destroy every element and free every block but the first
+		 */
+		void clear() {
+			for (iterator it = this->_start; it != this->_finish; ++it)
+				this->_allocator.destroy(it.base());
+			for (map_pointer node = this->_start.node() + 1; node <= this->_finish.node(); ++node)
+				this->deallocate_block(*node);
+			this->_finish = this->_start;
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+	private:
+		allocator_type _allocator;
+		map_pointer _map;
+		size_type _map_size;
+		iterator _start;
+		iterator _finish;
+
+		pointer allocate_block() {
+			return this->_allocator.allocate(ft::deque_block_size<value_type>());
+		}
+
+		void deallocate_block(pointer block) {
+			this->_allocator.deallocate(block, ft::deque_block_size<value_type>());
+		}
+
+		/**
+		 * @brief Create an empty map with a single block in the middle so both
+		 * ends can grow
+		 */
+		void initialize_map() {
+			map_allocator_type map_allocator(this->_allocator);
+			this->_map_size = 8;
+			this->_map = map_allocator.allocate(this->_map_size);
+			map_pointer node = this->_map + this->_map_size / 2;
+			try {
+				*node = this->allocate_block();
+			} catch (...) {
+				map_allocator.deallocate(this->_map, this->_map_size);
+				this->_map = 0;
+				throw;
+			}
+			this->_start.setNode(node);
+			this->_start.setCur(this->_start.first());
+			this->_finish = this->_start;
+		}
+
+		/**
+		 * @brief Destroy everything and free the blocks and the map
+		 */
+		void release() {
+			if (this->_map == 0) return;
+			this->clear();
+			this->deallocate_block(this->_start.first());
+			map_allocator_type(this->_allocator).deallocate(this->_map, this->_map_size);
+			this->_map = 0;
+		}
+
+		void reserve_map_at_back(size_type blocks_to_add) {
+			if (blocks_to_add + 1 > this->_map_size - (this->_finish.node() - this->_map))
+				this->reallocate_map(blocks_to_add, false);
+		}
+
+		void reserve_map_at_front(size_type blocks_to_add) {
+			if (blocks_to_add > static_cast<size_type>(this->_start.node() - this->_map))
+				this->reallocate_map(blocks_to_add, true);
+		}
+
+		/**
+		 * @brief Make room in the map for blocks_to_add more blocks on one side
+		 * @note Only block pointers move, either recentered in the current
+		 * map if it is less than half used or copied into a bigger map.
+		 * Elements are never copied.
+		 */
+		void reallocate_map(size_type blocks_to_add, bool add_at_front) {
+			size_type old_num_blocks = this->_finish.node() - this->_start.node() + 1;
+			size_type new_num_blocks = old_num_blocks + blocks_to_add;
+			map_pointer new_start;
+			if (this->_map_size > 2 * new_num_blocks) {
+				new_start = this->_map + (this->_map_size - new_num_blocks) / 2 + (add_at_front ? blocks_to_add : 0);
+				if (new_start < this->_start.node())
+					std::copy(this->_start.node(), this->_finish.node() + 1, new_start);
+				else
+					std::copy_backward(this->_start.node(), this->_finish.node() + 1, new_start + old_num_blocks);
+			} else {
+				map_allocator_type map_allocator(this->_allocator);
+				size_type new_map_size = this->_map_size + std::max(this->_map_size, blocks_to_add) + 2;
+				map_pointer new_map = map_allocator.allocate(new_map_size);
+				new_start = new_map + (new_map_size - new_num_blocks) / 2 + (add_at_front ? blocks_to_add : 0);
+				std::copy(this->_start.node(), this->_finish.node() + 1, new_start);
+				map_allocator.deallocate(this->_map, this->_map_size);
+				this->_map = new_map;
+				this->_map_size = new_map_size;
+			}
+			pointer start_cur = this->_start.base();
+			pointer finish_cur = this->_finish.base();
+			this->_start.setNode(new_start);
+			this->_start.setCur(start_cur);
+			this->_finish.setNode(new_start + old_num_blocks - 1);
+			this->_finish.setCur(finish_cur);
+		}
+
+		/**
+		 * @brief Undo the last n push on one end, used to roll back a failed
+		 * insert
+		 */
+		void unpush(size_type n, bool at_front) {
+			for (; n > 0; --n) {
+				if (at_front)
+					this->pop_front();
+				else
+					this->pop_back();
+			}
+		}
+
+		/**
+		 * @brief Rotate n elements just pushed on one end into position_idx
+		 */
+		void rotate_in(size_type position_idx, size_type n, bool at_front) {
+			if (at_front)
+				std::rotate(this->begin(), this->begin() + n, this->begin() + n + position_idx);
+			else
+				std::rotate(this->begin() + position_idx, this->end() - n, this->end());
+		}
+	};
+
+	template<typename T, typename Alloc>
+	bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		return false;
+	}
+
+	template<typename T, typename Alloc>
+	bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template<typename T, typename Alloc>
+	bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template<typename T, typename Alloc>
+	bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename T, typename Alloc>
+	bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename T, typename Alloc>
+	bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+}
+
+namespace std {
+	template<typename T, typename Alloc>
+	void swap(ft::deque<T, Alloc>& x, ft::deque<T, Alloc>& y) {
+		x.swap(y);
+	}
+}
@@ -0,0 +1,312 @@
+#pragma once
+
+#include "type_traits.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+
+namespace ft {
+	/**
+	 * @brief Vector whose growth never copies everything at once.
+	 * When full it allocates a buffer twice as big and keeps the old one
+	 * around, then every push_back/pop_back migrates at most Step elements
+	 * from the old buffer to the new one. Element i lives in the old buffer
+	 * while migrated() <= i < the old size, operator[] checks that range.
+	 * No single push_back does more than O(Step) element copies.
+	 * @note Step >= 1 finishes migrating before the new buffer is full.
+	 * @note Elements move between buffers, references are invalidated by
+	 * any push_back/pop_back during a migration.
+	 */
+	template< typename T, typename Allocator = std::allocator<T>, std::size_t Step = 2 >
+	class incremental_vector {
+	public:
+		typedef T													value_type;
+		typedef Allocator											allocator_type;
+		typedef typename Allocator::reference						reference;
+		typedef typename Allocator::const_reference					const_reference;
+		typedef typename Allocator::pointer							pointer;
+		typedef typename Allocator::const_pointer					const_pointer;
+		typedef std::ptrdiff_t										difference_type;
+		typedef std::size_t											size_type;
+
+	public:
+		// construct/copy/destroy
+
+		explicit incremental_vector(const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_storage_start(0),
+			_size(0),
+			_capacity(0),
+			_old_start(0),
+			_old_capacity(0),
+			_old_end(0),
+			_migrated(0) {
+			(void)sizeof(ft::compile_time_check<(Step > 0)>);
+		}
+
+		incremental_vector(const incremental_vector& x) :
+			_allocator(x.get_allocator()),
+			_storage_start(0),
+			_size(0),
+			_capacity(0),
+			_old_start(0),
+			_old_capacity(0),
+			_old_end(0),
+			_migrated(0) {
+			try {
+				this->reserve(x.size());
+				for (size_type i = 0; i < x.size(); ++i)
+					this->push_back(x[i]);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		~incremental_vector() {
+			this->release();
+		}
+
+		incremental_vector& operator=(const incremental_vector& x) {
+			if (&x == this) return *this;
+			incremental_vector tmp(x);
+			this->swap(tmp);
+			return *this;
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			return this->get_allocator().max_size();
+		}
+
+		size_type capacity() const {
+			return this->_capacity;
+		}
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		/**
+		 * @brief Start migrating to a buffer of n elements, O(1) unless a
+		 * migration is already running (it is finished first).
+		 * @throw std::length_error if n exceeds max_size().
+		 */
+		void reserve(size_type n) {
+			if (n > this->max_size())
+				throw std::length_error("incremental_vector: reserve");
+			if (n > this->_capacity)
+				this->start_migration(n);
+		}
+
+		/**
+		 * @brief Returns true while elements are left in the old buffer
+		 */
+		bool migrating() const {
+			return this->_old_start != 0;
+		}
+
+		/**
+		 * @brief Number of elements moved to the current buffer so far, only
+		 * meaningful while migrating()
+		 */
+		size_type migrated() const {
+			return this->_migrated;
+		}
+
+		/**
+		 * @brief Move every element left in the old buffer now, O(n)
+		 */
+		void finish_migration() {
+			while (this->migrating())
+				this->migrate(this->_old_end - this->_migrated);
+		}
+
+		// element access
+
+		reference operator[](size_type n) {
+			return *this->locate(n);
+		}
+
+		const_reference operator[](size_type n) const {
+			return *this->locate(n);
+		}
+
+		reference at(size_type n) {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return *this->locate(n);
+		}
+
+		const_reference at(size_type n) const {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return *this->locate(n);
+		}
+
+		reference front() {
+			return *this->locate(0);
+		}
+
+		const_reference front() const {
+			return *this->locate(0);
+		}
+
+		reference back() {
+			return *this->locate(this->_size - 1);
+		}
+
+		const_reference back() const {
+			return *this->locate(this->_size - 1);
+		}
+
+		// modifiers
+
+		/**
+		 * @brief Append val then migrate up to Step elements.
+		 * Growing only allocates the new buffer, O(1) copies.
+		 * @exception Strong guarantee for val, a failing migration copy
+		 * leaves that element in the old buffer (Basic guarantee)
+		 */
+		void push_back(const value_type& val) {
+			if (this->_size == this->_capacity) {
+				if (this->max_size() - this->_size < 1)
+					throw std::length_error("incremental_vector: push_back");
+				size_type new_capacity = this->_capacity + std::max<size_type>(this->_capacity, 1);
+				this->start_migration(new_capacity > this->max_size() ? this->max_size() : new_capacity);
+			}
+			this->_allocator.construct(this->_storage_start + this->_size, val);
+			this->_size++;
+			this->migrate(Step);
+		}
+
+		void pop_back() {
+			size_type last = this->_size - 1;
+			if (this->inOld(last)) {
+				this->_allocator.destroy(this->_old_start + last);
+				this->_old_end = last;
+			} else {
+				this->_allocator.destroy(this->_storage_start + last);
+			}
+			this->_size--;
+			this->migrate(Step);
+		}
+
+		void swap(incremental_vector& x) {
+			if (this == &x) return;
+			std::swap(this->_storage_start, x._storage_start);
+			std::swap(this->_size, x._size);
+			std::swap(this->_capacity, x._capacity);
+			std::swap(this->_old_start, x._old_start);
+			std::swap(this->_old_capacity, x._old_capacity);
+			std::swap(this->_old_end, x._old_end);
+			std::swap(this->_migrated, x._migrated);
+		}
+
+		void clear() {
+			while (this->_size > 0)
+				this->pop_back();
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+	private:
+		allocator_type _allocator;
+		pointer _storage_start;
+		size_type _size;
+		size_type _capacity;
+		// Old buffer, elements [_migrated, _old_end) still live there
+		pointer _old_start;
+		size_type _old_capacity;
+		size_type _old_end;
+		size_type _migrated;
+
+		bool inOld(size_type n) const {
+			return this->_old_start != 0 && n >= this->_migrated && n < this->_old_end;
+		}
+
+		pointer locate(size_type n) const {
+			return this->inOld(n) ? this->_old_start + n : this->_storage_start + n;
+		}
+
+		/**
+		 * @brief Make the current buffer the old one and switch to a new
+		 * buffer of new_capacity, nothing is copied yet
+		 */
+		void start_migration(size_type new_capacity) {
+			this->finish_migration();
+			pointer new_storage_start = this->_allocator.allocate(new_capacity);
+			this->_old_start = this->_storage_start;
+			this->_old_capacity = this->_capacity;
+			this->_old_end = this->_size;
+			this->_migrated = 0;
+			this->_storage_start = new_storage_start;
+			this->_capacity = new_capacity;
+			this->migrate(0);
+		}
+
+		/**
+		 * @brief Copy up to n elements from the old buffer, free it once
+		 * everything moved
+		 */
+		void migrate(size_type n) {
+			if (this->_old_start == 0)
+				return;
+			for (; n > 0 && this->_migrated < this->_old_end; --n) {
+				this->_allocator.construct(this->_storage_start + this->_migrated, this->_old_start[this->_migrated]);
+				this->_allocator.destroy(this->_old_start + this->_migrated);
+				this->_migrated++;
+			}
+			if (this->_migrated >= this->_old_end) {
+				if (this->_old_start != 0)
+					this->_allocator.deallocate(this->_old_start, this->_old_capacity);
+				this->_old_start = 0;
+				this->_old_capacity = 0;
+				this->_old_end = 0;
+				this->_migrated = 0;
+			}
+		}
+
+		void release() {
+			this->clear();
+			this->migrate(0);
+			if (this->_storage_start != 0)
+				this->_allocator.deallocate(this->_storage_start, this->_capacity);
+			this->_storage_start = 0;
+			this->_capacity = 0;
+		}
+	};
+
+	template<typename T, typename Alloc, std::size_t Step>
+	bool operator==(const incremental_vector<T, Alloc, Step>& lhs, const incremental_vector<T, Alloc, Step>& rhs) {
+		if (lhs.size() != rhs.size())
+			return false;
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			if (!(lhs[i] == rhs[i]))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, typename Alloc, std::size_t Step>
+	bool operator!=(const incremental_vector<T, Alloc, Step>& lhs, const incremental_vector<T, Alloc, Step>& rhs) {
+		return !(lhs == rhs);
+	}
+}
+
+namespace std {
+	template<typename T, typename Alloc, std::size_t Step>
+	void swap(ft::incremental_vector<T, Alloc, Step>& x, ft::incremental_vector<T, Alloc, Step>& y) {
+		x.swap(y);
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "type_traits.hpp"
 
+#include <climits>
+#include <cstddef>
 #include <iterator>
 
 namespace ft {
@@ -241,6 +243,499 @@ namespace ft {
 		return pointer_iterator<TPtr, Container>(rhs.base() + val);
 	}
 
+	// ft::is_contiguous_iterator
+	// Iterators over contiguous memory whose raw pointer can be taken with
+	// ft::unwrap_iterator, so algorithms reach the pointer overloads
+	// (memmove, memcmp, ...) of the standard library
+	template<typename Iterator>
+	struct is_contiguous_iterator : public false_type {};
+
+	template<typename T>
+	struct is_contiguous_iterator<T*> : public true_type {};
+
+	template<typename T>
+	struct is_contiguous_iterator<const T*> : public true_type {};
+
+	template<typename T, typename Container>
+	struct is_contiguous_iterator<pointer_iterator<T*, Container> > : public true_type {};
+
+	template<typename T, typename Container>
+	struct is_contiguous_iterator<pointer_iterator<const T*, Container> > : public true_type {};
+
+	// ft::unwrap_iterator
+	// Raw pointer of a contiguous iterator, any other iterator is returned
+	// as is. unwrapped_iterator<Iterator>::type is the result type.
+	template<typename Iterator>
+	struct unwrapped_iterator {
+		typedef Iterator type;
+	};
+
+	template<typename TPtr, typename Container>
+	struct unwrapped_iterator<pointer_iterator<TPtr, Container> > {
+		typedef TPtr type;
+	};
+
+	template<typename Iterator>
+	Iterator unwrap_iterator(Iterator it) {
+		return it;
+	}
+
+	template<typename TPtr, typename Container>
+	TPtr unwrap_iterator(const pointer_iterator<TPtr, Container>& it) {
+		return it.base();
+	}
+
+	// ft::deque_iterator
+	// Block size of ft::deque: 512 bytes worth of elements, at least one
+	template<typename T>
+	inline std::ptrdiff_t deque_block_size() {
+		return sizeof(T) < 512 ? static_cast<std::ptrdiff_t>(512 / sizeof(T)) : 1;
+	}
+
+	/**
+	 * @brief Random access iterator over ft::deque blocks. Points at an
+	 * element (cur) and at the block map entry (node) of its block.
+	 */
+	template<typename TPtr, typename T>
+	class deque_iterator {
+	public:
+		typedef typename ft::iterator_traits<TPtr>::difference_type	difference_type;
+		typedef typename ft::iterator_traits<TPtr>::value_type		value_type;
+		typedef typename ft::iterator_traits<TPtr>::pointer			pointer;
+		typedef typename ft::iterator_traits<TPtr>::reference		reference;
+		typedef std::random_access_iterator_tag						iterator_category;
+		typedef T**													map_pointer;
+
+	public:
+		deque_iterator() : _cur(0), _first(0), _last(0), _node(0) {
+			#ifdef DEBUG
+				std::cout << "deque_iterator default constructor called" << std::endl;
+			#endif
+		}
+
+		deque_iterator(pointer cur, map_pointer node) :
+			_cur(cur),
+			_first(*node),
+			_last(*node + ft::deque_block_size<T>()),
+			_node(node) {
+			#ifdef DEBUG
+				std::cout << "deque_iterator pointer constructor called" << std::endl;
+			#endif
+		}
+
+		template<typename _TPtr>
+		deque_iterator(const deque_iterator<_TPtr, typename ft::enable_if<ft::are_same<_TPtr, T*>::value, T>::type>& copy) :
+			_cur(copy.base()),
+			_first(copy.first()),
+			_last(copy.last()),
+			_node(copy.node()) {
+			#ifdef DEBUG
+				std::cout << "deque_iterator const conversion constructor called" << std::endl;
+			#endif
+		}
+
+		deque_iterator(const deque_iterator& copy) :
+			_cur(copy._cur),
+			_first(copy._first),
+			_last(copy._last),
+			_node(copy._node) {
+			#ifdef DEBUG
+				std::cout << "deque_iterator copy constructor called" << std::endl;
+			#endif
+		}
+
+		deque_iterator& operator=(const deque_iterator& rhs) {
+			#ifdef DEBUG
+				std::cout << "deque_iterator assignment operator called" << std::endl;
+			#endif
+			this->_cur = rhs._cur;
+			this->_first = rhs._first;
+			this->_last = rhs._last;
+			this->_node = rhs._node;
+			return *this;
+		}
+
+		~deque_iterator() {
+			#ifdef DEBUG
+				std::cout << "deque_iterator deconstructor called" << std::endl;
+			#endif
+		}
+
+		deque_iterator& operator+=(difference_type val) {
+			difference_type offset = val + (this->_cur - this->_first);
+			difference_type block_size = ft::deque_block_size<T>();
+			if (offset >= 0 && offset < block_size) {
+				this->_cur += val;
+			} else {
+				difference_type node_offset = offset > 0 ? offset / block_size : -((-offset - 1) / block_size) - 1;
+				this->setNode(this->_node + node_offset);
+				this->_cur = this->_first + (offset - node_offset * block_size);
+			}
+			return *this;
+		}
+
+		deque_iterator& operator-=(difference_type val) {
+			return *this += -val;
+		}
+
+		deque_iterator operator+(difference_type val) const {
+			deque_iterator tmp(*this);
+			return tmp += val;
+		}
+
+		deque_iterator operator-(difference_type val) const {
+			deque_iterator tmp(*this);
+			return tmp -= val;
+		}
+
+		deque_iterator& operator++() {
+			++this->_cur;
+			if (this->_cur == this->_last) {
+				this->setNode(this->_node + 1);
+				this->_cur = this->_first;
+			}
+			return *this;
+		}
+
+		deque_iterator operator++(int) {
+			deque_iterator tmp(*this);
+			++*this;
+			return tmp;
+		}
+
+		deque_iterator& operator--() {
+			if (this->_cur == this->_first) {
+				this->setNode(this->_node - 1);
+				this->_cur = this->_last;
+			}
+			--this->_cur;
+			return *this;
+		}
+
+		deque_iterator operator--(int) {
+			deque_iterator tmp(*this);
+			--*this;
+			return tmp;
+		}
+
+		reference operator*() const {
+			return *this->_cur;
+		}
+
+		pointer operator->() const {
+			return this->_cur;
+		}
+
+		reference operator[](const difference_type& n) const {
+			return *(*this + n);
+		}
+
+		pointer base() const {
+			return this->_cur;
+		}
+
+		pointer first() const {
+			return this->_first;
+		}
+
+		pointer last() const {
+			return this->_last;
+		}
+
+		map_pointer node() const {
+			return this->_node;
+		}
+
+		/**
+		 * @brief Move to the block of node, cur is left for the caller
+		 */
+		void setNode(map_pointer node) {
+			this->_node = node;
+			this->_first = *node;
+			this->_last = *node + ft::deque_block_size<T>();
+		}
+
+		void setCur(pointer cur) {
+			this->_cur = cur;
+		}
+
+	protected:
+		pointer _cur;
+		pointer _first;
+		pointer _last;
+		map_pointer _node;
+	};
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	typename ft::iterator_traits<TPtr1>::difference_type operator-(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return ft::deque_block_size<T>() * (lhs.node() - rhs.node() - 1) + (lhs.base() - lhs.first()) + (rhs.last() - rhs.base());
+	}
+
+	template<typename TPtr, typename T>
+	deque_iterator<TPtr, T> operator+(typename ft::iterator_traits<TPtr>::difference_type val, const deque_iterator<TPtr, T>& rhs) {
+		return rhs + val;
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator==(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return lhs.base() == rhs.base();
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator!=(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return lhs.base() != rhs.base();
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator<(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return lhs.node() == rhs.node() ? lhs.base() < rhs.base() : lhs.node() < rhs.node();
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator<=(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator>(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename TPtr1, typename TPtr2, typename T>
+	bool operator>=(const deque_iterator<TPtr1, T>& lhs, const deque_iterator<TPtr2, T>& rhs) {
+		return !(lhs < rhs);
+	}
+
+	// Bit storage for the packed ft::vector<bool>, bits are kept in the
+	// low to high order of unsigned long words.
+	typedef unsigned long bit_word;
+
+	inline std::size_t bit_word_size() {
+		return sizeof(bit_word) * CHAR_BIT;
+	}
+
+	/**
+	 * @brief Proxy for one bit of a bit_word, what ft::vector<bool> returns
+	 * instead of bool&
+	 */
+	class bit_reference {
+	public:
+		bit_reference(bit_word* word, bit_word mask) : _word(word), _mask(mask) {}
+
+		bit_reference(const bit_reference& copy) : _word(copy._word), _mask(copy._mask) {}
+
+		operator bool() const {
+			return (*this->_word & this->_mask) != 0;
+		}
+
+		bit_reference& operator=(bool val) {
+			if (val)
+				*this->_word |= this->_mask;
+			else
+				*this->_word &= ~this->_mask;
+			return *this;
+		}
+
+		bit_reference& operator=(const bit_reference& rhs) {
+			return *this = bool(rhs);
+		}
+
+		bool operator~() const {
+			return !bool(*this);
+		}
+
+		void flip() {
+			*this->_word ^= this->_mask;
+		}
+
+	private:
+		bit_word* _word;
+		bit_word _mask;
+	};
+
+	inline void swap(bit_reference x, bit_reference y) {
+		bool tmp = x;
+		x = y;
+		y = tmp;
+	}
+
+	/**
+	 * @brief Random access iterator over packed bits. Points at a word and
+	 * a bit offset in it, Reference is bit_reference or bool (const).
+	 */
+	template<typename Reference, typename WordPtr>
+	class bit_iterator {
+	public:
+		typedef std::ptrdiff_t										difference_type;
+		typedef bool												value_type;
+		typedef void												pointer;
+		typedef Reference											reference;
+		typedef std::random_access_iterator_tag						iterator_category;
+
+	public:
+		bit_iterator() : _word(0), _offset(0) {
+			#ifdef DEBUG
+				std::cout << "bit_iterator default constructor called" << std::endl;
+			#endif
+		}
+
+		bit_iterator(WordPtr word, std::size_t offset) : _word(word), _offset(offset) {
+			#ifdef DEBUG
+				std::cout << "bit_iterator word constructor called" << std::endl;
+			#endif
+		}
+
+		template<typename _Reference>
+		bit_iterator(const bit_iterator<_Reference, typename ft::enable_if<ft::are_same<_Reference, bit_reference>::value, bit_word*>::type>& copy) :
+			_word(copy.word()),
+			_offset(copy.offset()) {
+			#ifdef DEBUG
+				std::cout << "bit_iterator const conversion constructor called" << std::endl;
+			#endif
+		}
+
+		bit_iterator(const bit_iterator& copy) : _word(copy._word), _offset(copy._offset) {
+			#ifdef DEBUG
+				std::cout << "bit_iterator copy constructor called" << std::endl;
+			#endif
+		}
+
+		bit_iterator& operator=(const bit_iterator& rhs) {
+			#ifdef DEBUG
+				std::cout << "bit_iterator assignment operator called" << std::endl;
+			#endif
+			this->_word = rhs._word;
+			this->_offset = rhs._offset;
+			return *this;
+		}
+
+		~bit_iterator() {
+			#ifdef DEBUG
+				std::cout << "bit_iterator deconstructor called" << std::endl;
+			#endif
+		}
+
+		bit_iterator& operator+=(difference_type val) {
+			difference_type offset = val + static_cast<difference_type>(this->_offset);
+			difference_type bits = static_cast<difference_type>(ft::bit_word_size());
+			difference_type word_offset = offset >= 0 ? offset / bits : -((-offset - 1) / bits) - 1;
+			this->_word += word_offset;
+			this->_offset = static_cast<std::size_t>(offset - word_offset * bits);
+			return *this;
+		}
+
+		bit_iterator& operator-=(difference_type val) {
+			return *this += -val;
+		}
+
+		bit_iterator operator+(difference_type val) const {
+			bit_iterator tmp(*this);
+			return tmp += val;
+		}
+
+		bit_iterator operator-(difference_type val) const {
+			bit_iterator tmp(*this);
+			return tmp -= val;
+		}
+
+		bit_iterator& operator++() {
+			if (++this->_offset == ft::bit_word_size()) {
+				this->_offset = 0;
+				++this->_word;
+			}
+			return *this;
+		}
+
+		bit_iterator operator++(int) {
+			bit_iterator tmp(*this);
+			++*this;
+			return tmp;
+		}
+
+		bit_iterator& operator--() {
+			if (this->_offset-- == 0) {
+				this->_offset = ft::bit_word_size() - 1;
+				--this->_word;
+			}
+			return *this;
+		}
+
+		bit_iterator operator--(int) {
+			bit_iterator tmp(*this);
+			--*this;
+			return tmp;
+		}
+
+		reference operator*() const {
+			return bit_iterator::deref(this->_word, bit_word(1) << this->_offset, static_cast<Reference*>(0));
+		}
+
+		reference operator[](const difference_type& n) const {
+			return *(*this + n);
+		}
+
+		WordPtr word() const {
+			return this->_word;
+		}
+
+		std::size_t offset() const {
+			return this->_offset;
+		}
+
+	protected:
+		WordPtr _word;
+		std::size_t _offset;
+
+		static bit_reference deref(bit_word* word, bit_word mask, bit_reference*) {
+			return bit_reference(word, mask);
+		}
+
+		static bool deref(const bit_word* word, bit_word mask, bool*) {
+			return (*word & mask) != 0;
+		}
+	};
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	std::ptrdiff_t operator-(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return static_cast<std::ptrdiff_t>(ft::bit_word_size()) * (lhs.word() - rhs.word())
+			+ static_cast<std::ptrdiff_t>(lhs.offset()) - static_cast<std::ptrdiff_t>(rhs.offset());
+	}
+
+	template<typename Reference, typename WordPtr>
+	bit_iterator<Reference, WordPtr> operator+(std::ptrdiff_t val, const bit_iterator<Reference, WordPtr>& rhs) {
+		return rhs + val;
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator==(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return lhs.word() == rhs.word() && lhs.offset() == rhs.offset();
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator!=(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator<(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return lhs.word() == rhs.word() ? lhs.offset() < rhs.offset() : lhs.word() < rhs.word();
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator<=(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator>(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename Reference1, typename WordPtr1, typename Reference2, typename WordPtr2>
+	bool operator>=(const bit_iterator<Reference1, WordPtr1>& lhs, const bit_iterator<Reference2, WordPtr2>& rhs) {
+		return !(lhs < rhs);
+	}
+
 	// ft:rai_reverse_iterator
 	template<typename Iterator>
 	class rai_reverse_iterator {
@@ -574,6 +1069,170 @@ namespace ft {
 		return lhs.base() != rhs.base();
 	}
 
+	// ft::compact_bst_iterator
+	// Same walk as bst_iterator but nodes are indices into an arena, so the
+	// iterator survives the arena reallocating. The tree keeps the arena on
+	// the heap, so the iterator also survives swap
+	template<typename TPtr, typename Node, typename Arena>
+	class compact_bst_iterator {
+	private:
+		typedef Node												node_type;
+		typedef typename Node::index_type							index_type;
+
+	public:
+		typedef typename ft::iterator_traits<TPtr>::difference_type	difference_type;
+		typedef typename ft::iterator_traits<TPtr>::value_type		value_type;
+		typedef typename ft::iterator_traits<TPtr>::pointer			pointer;
+		typedef typename ft::iterator_traits<TPtr>::reference		reference;
+		typedef std::bidirectional_iterator_tag						iterator_category;
+
+	public:
+		compact_bst_iterator() : _arena(0), _idx(node_type::npos), _tail(node_type::npos), _isReversed(false) {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator default constructor called" << std::endl;
+			#endif
+		}
+
+		compact_bst_iterator(Arena* arena, index_type idx, index_type tail, bool isReversed = false) :
+			_arena(arena),
+			_idx(idx),
+			_tail(tail),
+			_isReversed(isReversed) {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator index constructor called" << std::endl;
+			#endif
+		}
+
+		template<typename _TPtr>
+		compact_bst_iterator(const compact_bst_iterator<_TPtr, typename ft::enable_if<ft::are_same<_TPtr, typename Node::pointer>::value, node_type>::type, Arena>& copy) :
+			_arena(copy.arena()),
+			_idx(copy.base()),
+			_tail(copy.tail()),
+			_isReversed(copy.isReversed()) {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator const conversion constructor called" << std::endl;
+			#endif
+		}
+
+		compact_bst_iterator(const compact_bst_iterator& copy) :
+			_arena(copy._arena),
+			_idx(copy._idx),
+			_tail(copy._tail),
+			_isReversed(copy._isReversed) {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator copy constructor called" << std::endl;
+			#endif
+		}
+
+		compact_bst_iterator& operator=(const compact_bst_iterator& rhs) {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator assignment operator called" << std::endl;
+			#endif
+			this->_arena = rhs._arena;
+			this->_idx = rhs._idx;
+			this->_tail = rhs._tail;
+			this->_isReversed = rhs._isReversed;
+			return *this;
+		}
+
+		~compact_bst_iterator() {
+			#ifdef DEBUG
+				std::cout << "compact_bst_iterator deconstructor called" << std::endl;
+			#endif
+		}
+
+		compact_bst_iterator& operator++() {
+			this->_idx = this->tree_increment(this->_idx);
+			return *this;
+		}
+
+		compact_bst_iterator operator++(int) {
+			compact_bst_iterator tmp = *this;
+			this->_idx = this->tree_increment(this->_idx);
+			return tmp;
+		}
+
+		compact_bst_iterator& operator--() {
+			this->_idx = this->tree_decrement(this->_idx);
+			return *this;
+		}
+
+		compact_bst_iterator operator--(int) {
+			compact_bst_iterator tmp = *this;
+			this->_idx = this->tree_decrement(this->_idx);
+			return tmp;
+		}
+
+		reference operator*() const {
+			return this->_arena->value(this->_idx);
+		}
+
+		pointer operator->() const {
+			return &this->_arena->value(this->_idx);
+		}
+
+		index_type base() const {
+			return this->_idx;
+		}
+
+		index_type tail() const {
+			return this->_tail;
+		}
+
+		bool isReversed() const {
+			return this->_isReversed;
+		}
+
+		Arena* arena() const {
+			return this->_arena;
+		}
+
+	private:
+		index_type tree_increment(index_type idx) {
+			if (idx == node_type::npos)
+				return this->_tail;
+			index_type current = node_type::getSuccessor(*this->_arena, idx);
+			if (idx == current && !this->_isReversed)
+				return node_type::npos;
+			return current;
+		}
+
+		index_type tree_decrement(index_type idx) {
+			if (idx == node_type::npos)
+				return this->_tail;
+			index_type current = node_type::getPredecessor(*this->_arena, idx);
+			if (idx == current && this->_isReversed)
+				return node_type::npos;
+			return current;
+		}
+
+	protected:
+		Arena* _arena;
+		index_type _idx;
+		index_type _tail;
+		bool _isReversed;
+	};
+
+	template<typename TPtr1, typename TPtr2, typename Node, typename Arena>
+	bool operator==(const compact_bst_iterator<TPtr1, Node, Arena>& lhs, const compact_bst_iterator<TPtr2, Node, Arena>& rhs) {
+		return lhs.base() == rhs.base();
+	}
+
+	template<typename TPtr, typename Node, typename Arena>
+	bool operator==(const compact_bst_iterator<TPtr, Node, Arena>& lhs, const compact_bst_iterator<TPtr, Node, Arena>& rhs) {
+		return lhs.base() == rhs.base();
+	}
+
+	template<typename TPtr1, typename TPtr2, typename Node, typename Arena>
+	bool operator!=(const compact_bst_iterator<TPtr1, Node, Arena>& lhs, const compact_bst_iterator<TPtr2, Node, Arena>& rhs) {
+		return lhs.base() != rhs.base();
+	}
+
+	template<typename TPtr, typename Node, typename Arena>
+	bool operator!=(const compact_bst_iterator<TPtr, Node, Arena>& lhs, const compact_bst_iterator<TPtr, Node, Arena>& rhs) {
+		return lhs.base() != rhs.base();
+	}
+
 	// ft:bd_reverse_iterator
 	template<typename Iterator>
 	class bd_reverse_iterator {
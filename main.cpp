@@ -5,15 +5,31 @@
 #include "tree.hpp"
 #include "map.hpp"
 #include "set.hpp"
+#include "small_vector.hpp"
+#include "deque.hpp"
+#include "queue.hpp"
+#include "incremental_vector.hpp"
+#include "mmap_vector.hpp"
+#include "span.hpp"
 
 #include <iostream>
 // #include <type_traits> // C++11
 #include <vector>
 #include <stack>
+#include <deque>
+#include <queue>
 #include <set>
+#include <map>
 #include <cstdlib>
+#include <cstdio>
 #include <sstream>
+#include <iterator>
+#include <string>
 #include <exception>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <unistd.h>
 
 # define COLOR_DEFAULT "\033[0m"
 # define COLOR_RED "\033[31;1m"
@@ -56,6 +72,175 @@ void	RBTSetIteratorTest(Iter1First my_it, Iter1Last my_ite, Iter2First std_it, I
 	isEqual(*(my_ite--), *(std_ite--));
 }
 
+// Owns a heap int and counts the live instances, to check containers
+// destroy what they erase
+struct Counted {
+	static int live;
+	int* value;
+
+	Counted(int v = 0) : value(new int(v)) { ++live; }
+	Counted(const Counted& other) : value(new int(*other.value)) { ++live; }
+	~Counted() { delete value; --live; }
+	Counted& operator=(const Counted& other) { *value = *other.value; return *this; }
+};
+
+int Counted::live = 0;
+
+// Plain struct opted in to the memcpy/memmove paths of the containers
+struct Point {
+	int x;
+	int y;
+};
+
+namespace ft { template<> struct is_trivially_copyable<Point> : public true_type {}; }
+
+bool	isOdd(int n)
+{
+	return n % 2 != 0;
+}
+
+bool	hasOddValue(ft::pair<const int, int> const & p)
+{
+	return p.second % 2 != 0;
+}
+
+// Only the span overload may take a contiguous container, anything
+// without data()/size() must fall through to the other one
+int	spanOrOther(ft::span<const int> s)
+{
+	return static_cast<int>(s.size());
+}
+
+int	spanOrOther(std::set<int> const &)
+{
+	return -1;
+}
+
+// Stateful allocator that remembers which instance allocated each block,
+// to catch memory freed by an allocator that didn't allocate it
+template<class T>
+struct TaggedAllocator : public std::allocator<T> {
+	template<class U>
+	struct rebind {
+		typedef TaggedAllocator<U> other;
+	};
+
+	int id;
+
+	TaggedAllocator(int i = 0) : id(i) {}
+	TaggedAllocator(const TaggedAllocator& other) : std::allocator<T>(other), id(other.id) {}
+	TaggedAllocator& operator=(const TaggedAllocator& other) { this->id = other.id; return *this; }
+	template<class U>
+	TaggedAllocator(const TaggedAllocator<U>& other) : std::allocator<T>(), id(other.id) {}
+
+	T* allocate(size_t n, const void* = 0) {
+		T* p = std::allocator<T>::allocate(n);
+		owners()[p] = this->id;
+		return p;
+	}
+
+	void deallocate(T* p, size_t n) {
+		if (p == NULL)
+			return;
+		if (owners()[p] != this->id)
+			++mismatches();
+		owners().erase(p);
+		std::allocator<T>::deallocate(p, n);
+	}
+
+	static std::map<void*, int>& owners() {
+		static std::map<void*, int> owners;
+		return owners;
+	}
+
+	static int& mismatches() {
+		static int mismatches = 0;
+		return mismatches;
+	}
+};
+
+template<class T, class U>
+bool	operator==(const TaggedAllocator<T>& lhs, const TaggedAllocator<U>& rhs)
+{
+	return lhs.id == rhs.id;
+}
+
+template<class T, class U>
+bool	operator!=(const TaggedAllocator<T>& lhs, const TaggedAllocator<U>& rhs)
+{
+	return lhs.id != rhs.id;
+}
+
+template<class V1, class V2>
+void	VectorContentTest(V1 const & my, V2 const & std)
+{
+	isEqual(my.size(), std.size());
+	for (size_t i = 0; i < my.size() && i < std.size(); ++i)
+		isEqual(my[i], std[i]);
+}
+
+template<class M1, class M2>
+void	MapContentTest(M1 const & my, M2 const & std)
+{
+	BasicMapStats(my, std);
+	typename M1::const_iterator my_it = my.begin();
+	typename M2::const_iterator std_it = std.begin();
+	for (; my_it != my.end() && std_it != std.end(); ++my_it, ++std_it)
+	{
+		isEqual(my_it->first, std_it->first);
+		isEqual(my_it->second, std_it->second);
+	}
+}
+
+template<class T>
+void	CompareKernelTest(T first, T second)
+{
+	// long enough for the vector loops, mismatches in the head, middle
+	// and scalar tail
+	ft::vector<T> myA(300, first);
+	std::vector<T> stdA(300, first);
+	size_t positions[] = { 0, 17, 150, 299 };
+	for (size_t i = 0; i < 4; ++i)
+	{
+		ft::vector<T> myB(myA);
+		std::vector<T> stdB(stdA);
+		myB[positions[i]] = second;
+		stdB[positions[i]] = second;
+		isEqual(ft::equal(myA.begin(), myA.end(), myB.begin()), std::equal(stdA.begin(), stdA.end(), stdB.begin()));
+		isEqual(ft::lexicographical_compare(myA.begin(), myA.end(), myB.begin(), myB.end()),
+			std::lexicographical_compare(stdA.begin(), stdA.end(), stdB.begin(), stdB.end()));
+		isEqual(ft::lexicographical_compare(myB.begin(), myB.end(), myA.begin(), myA.end()),
+			std::lexicographical_compare(stdB.begin(), stdB.end(), stdA.begin(), stdA.end()));
+		isEqual(myA < myB, stdA < stdB);
+		isEqual(myA == myB, stdA == stdB);
+	}
+	isEqual(ft::lexicographical_compare(myA.begin(), myA.begin() + 299, myA.begin(), myA.end()), true);
+}
+
+template<class V>
+void	GrowthPolicyTest(V & my)
+{
+	std::vector<int> std;
+	size_t reallocations = 0;
+	bool fits = true;
+	for (int i = 0; i < 1000; ++i)
+	{
+		size_t capacity = my.capacity();
+		my.push_back(i);
+		std.push_back(i);
+		if (my.capacity() != capacity)
+			++reallocations;
+		fits = fits && my.capacity() >= my.size();
+	}
+	isEqual(fits, true);
+	my.insert(my.begin() + 10, 500, -1);
+	std.insert(std.begin() + 10, 500, -1);
+	my.reserve(4000);
+	isEqual(my.capacity() >= 4000, true);
+	isEqual(reallocations > 0, true);
+	VectorContentTest(my, std);
+}
+
 int main() {
 	typedef int myType;
 
@@ -480,6 +665,1058 @@ int main() {
 	RelationalTest(mySet11, mySet11, stdSet11, stdSet11);
 	RelationalTest(mySet12, mySet12, stdSet12, stdSet12);
 
+	{
+		std::cout << "\n\n25. Testing [Map] splay_tree insert, find, erase, insert_parallel:\n";
+		typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >, ft::splay_tree> splayMap;
+		splayMap mySplay;
+		std::map<int, int> stdSplay;
+		for (int i = 0; i < 50; ++i)
+		{
+			mySplay.insert(ft::make_pair((i * 37) % 101, i));
+			stdSplay.insert(std::make_pair((i * 37) % 101, i));
+		}
+		for (int i = 0; i < 101; i += 3)
+		{
+			isEqual(mySplay.count(i), stdSplay.count(i));
+			isEqual(mySplay.find(i) == mySplay.end(), stdSplay.find(i) == stdSplay.end());
+		}
+		const splayMap& constSplay = mySplay;
+		isEqual(constSplay.find(37)->second, stdSplay.find(37)->second);
+		for (int i = 0; i < 101; i += 4)
+			isEqual(mySplay.erase(i), stdSplay.erase(i));
+
+		std::vector<ft::pair<int, int> > bulk;
+		for (int i = 0; i < 200; ++i)
+			bulk.push_back(ft::make_pair((i * 53) % 151, -i));
+		mySplay.insert_parallel(bulk.begin(), bulk.end(), 2);
+		for (size_t i = 0; i < bulk.size(); ++i)
+			stdSplay.insert(std::make_pair(bulk[i].first, bulk[i].second));
+		BasicMapStats(mySplay, stdSplay);
+		splayMap::iterator my_it = mySplay.begin();
+		for (std::map<int, int>::iterator std_it = stdSplay.begin(); std_it != stdSplay.end(); ++std_it, ++my_it)
+		{
+			isEqual(my_it->first, std_it->first);
+			isEqual(my_it->second, std_it->second);
+		}
+	}
+
+	{
+		std::cout << "\n\n26. Testing [Map] compact_red_black_tree erase destroys values:\n";
+		typedef ft::map<int, Counted, ft::less<int>, std::allocator<ft::pair<const int, Counted> >, ft::compact_red_black_tree> compactMap;
+		{
+			compactMap myCompact;
+			std::map<int, int> stdCompact;
+			for (int i = 0; i < 300; ++i)
+			{
+				int key = (i * 61) % 97;
+				if (i % 3 == 2)
+					isEqual(myCompact.erase(key), stdCompact.erase(key));
+				else
+				{
+					myCompact.insert(ft::make_pair(key, Counted(i)));
+					stdCompact.insert(std::make_pair(key, i));
+				}
+			}
+			BasicMapStats(myCompact, stdCompact);
+			isEqual(Counted::live, static_cast<int>(stdCompact.size()));
+			compactMap::iterator my_it = myCompact.begin();
+			for (std::map<int, int>::iterator std_it = stdCompact.begin(); std_it != stdCompact.end(); ++std_it, ++my_it)
+			{
+				isEqual(my_it->first, std_it->first);
+				isEqual(*my_it->second.value, std_it->second);
+			}
+			compactMap myCopy(myCompact);
+			myCopy.erase(myCopy.begin(), myCopy.end());
+			isEqual(Counted::live, static_cast<int>(stdCompact.size()));
+		}
+		isEqual(Counted::live, 0);
+	}
+
+	{
+		std::cout << "\n\n27. Testing [Set] compact_red_black_tree iterators after swap:\n";
+		typedef ft::set<int, ft::less<int>, std::allocator<int>, ft::compact_red_black_tree> compactSet;
+		compactSet myFirst;
+		compactSet mySecond;
+		std::set<int> stdFirst;
+		std::set<int> stdSecond;
+		for (int i = 0; i < 20; ++i)
+		{
+			myFirst.insert(i * 3);
+			stdFirst.insert(i * 3);
+		}
+		for (int i = 0; i < 5; ++i)
+		{
+			mySecond.insert(100 + i);
+			stdSecond.insert(100 + i);
+		}
+		compactSet::iterator my_it = myFirst.find(27);
+		compactSet::iterator my_it2 = mySecond.begin();
+		std::set<int>::iterator std_it = stdFirst.find(27);
+		std::set<int>::iterator std_it2 = stdSecond.begin();
+
+		myFirst.swap(mySecond);
+		stdFirst.swap(stdSecond);
+		BasicMapStats(myFirst, stdFirst);
+		BasicMapStats(mySecond, stdSecond);
+		isEqual(*my_it, *std_it);
+		isEqual(*my_it2, *std_it2);
+		isEqual(ft::equal(my_it, compactSet::iterator(mySecond.end()), std_it), true);
+		isEqual(ft::equal(my_it2, compactSet::iterator(myFirst.end()), std_it2), true);
+		mySecond.erase(my_it);
+		stdSecond.erase(std_it);
+		isEqual(ft::equal(mySecond.begin(), mySecond.end(), stdSecond.begin()), true);
+	}
+
+	{
+		std::cout << "\n\n28. Testing [Map] [Set] insert_parallel:\n";
+		ft::map<int, int> myMap;
+		std::map<int, int> stdMap;
+		ft::set<int> mySet5;
+		std::set<int> stdSet5;
+		for (int i = 0; i < 30; ++i)
+		{
+			myMap.insert(ft::make_pair(i * 7, i));
+			stdMap.insert(std::make_pair(i * 7, i));
+		}
+		std::vector<ft::pair<int, int> > bulk;
+		std::vector<int> keys;
+		for (int i = 0; i < 500; ++i)
+		{
+			bulk.push_back(ft::make_pair((i * 389) % 467, -i));
+			keys.push_back((i * 389) % 467);
+		}
+		myMap.insert_parallel(bulk.begin(), bulk.end(), 3);
+		mySet5.insert_parallel(keys.begin(), keys.end(), 0);
+		for (size_t i = 0; i < bulk.size(); ++i)
+		{
+			stdMap.insert(std::make_pair(bulk[i].first, bulk[i].second));
+			stdSet5.insert(keys[i]);
+		}
+		BasicMapStats(myMap, stdMap);
+		BasicMapStats(mySet5, stdSet5);
+		ft::map<int, int>::iterator my_it = myMap.begin();
+		for (std::map<int, int>::iterator std_it = stdMap.begin(); std_it != stdMap.end(); ++std_it, ++my_it)
+		{
+			isEqual(my_it->first, std_it->first);
+			isEqual(my_it->second, std_it->second);
+		}
+		isEqual(ft::equal(mySet5.begin(), mySet5.end(), stdSet5.begin()), true);
+		myMap.insert(ft::make_pair(1000, 1));
+		stdMap.insert(std::make_pair(1000, 1));
+		isEqual(myMap.erase(7), stdMap.erase(7));
+		isEqual((--myMap.end())->first, (--stdMap.end())->first);
+		BasicMapStats(myMap, stdMap);
+	}
+
+	{
+		std::cout << "\n\n29. Testing deferred_destroy on vector, map and set:\n";
+		ft::vector<int> myVector(1000, 42);
+		std::vector<int> stdVector(1000, 42);
+		ft::map<int, Counted, std::greater<int> > myGreater;
+		std::map<int, int, std::greater<int> > stdGreater;
+		ft::set<int, std::greater<int> > myGreaterSet;
+		std::set<int, std::greater<int> > stdGreaterSet;
+		for (int i = 0; i < 100; ++i)
+		{
+			myGreater.insert(ft::make_pair(i, Counted(i)));
+			myGreaterSet.insert(i);
+		}
+		ft::deferred_destroy(myVector);
+		ft::deferred_destroy(myGreater);
+		ft::deferred_destroy(myGreaterSet);
+		stdVector.clear();
+		isEqual(myVector.size(), stdVector.size());
+		BasicMapStats(myGreater, stdGreater);
+		BasicMapStats(myGreaterSet, stdGreaterSet);
+		for (int i = 0; i < 10; ++i)
+		{
+			myVector.push_back(i);
+			stdVector.push_back(i);
+			myGreater.insert(ft::make_pair((i * 7) % 10, Counted(i)));
+			stdGreater.insert(std::make_pair((i * 7) % 10, i));
+			myGreaterSet.insert((i * 3) % 10);
+			stdGreaterSet.insert((i * 3) % 10);
+		}
+		ft::deferred_destroy_wait();
+		isEqual(ft::equal(myVector.begin(), myVector.end(), stdVector.begin()), true);
+		isEqual(ft::equal(myGreaterSet.begin(), myGreaterSet.end(), stdGreaterSet.begin()), true);
+		isEqual(myGreater.begin()->first, stdGreater.begin()->first);
+		isEqual(Counted::live, static_cast<int>(stdGreater.size()));
+	}
+
+	{
+		std::cout << "\n\n30. Testing [Map] insert_sorted_batch, upsert_sorted_batch and hinted insert:\n";
+		ft::map<int, int> myBatch;
+		std::map<int, int> stdBatch;
+		for (int i = 0; i < 40; i += 2)
+		{
+			myBatch.insert(myBatch.end(), ft::make_pair(i, i));
+			stdBatch.insert(stdBatch.end(), std::make_pair(i, i));
+		}
+		std::vector<ft::pair<int, int> > sorted;
+		for (int i = 0; i < 60; i += 3)
+			sorted.push_back(ft::make_pair(i, -i));
+		myBatch.insert_sorted_batch(sorted.begin(), sorted.end());
+		for (size_t i = 0; i < sorted.size(); ++i)
+			stdBatch.insert(std::make_pair(sorted[i].first, sorted[i].second));
+		BasicMapStats(myBatch, stdBatch);
+		isEqual(myBatch[6], stdBatch[6]);
+		isEqual(myBatch[9], stdBatch[9]);
+
+		std::vector<ft::pair<int, int> > updates;
+		for (int i = 1; i < 80; i += 5)
+			updates.push_back(ft::make_pair(i, i * 100));
+		myBatch.upsert_sorted_batch(updates.begin(), updates.end());
+		for (size_t i = 0; i < updates.size(); ++i)
+			stdBatch[updates[i].first] = updates[i].second;
+		BasicMapStats(myBatch, stdBatch);
+		ft::map<int, int>::iterator my_it = myBatch.begin();
+		for (std::map<int, int>::iterator std_it = stdBatch.begin(); std_it != stdBatch.end(); ++std_it, ++my_it)
+		{
+			isEqual(my_it->first, std_it->first);
+			isEqual(my_it->second, std_it->second);
+		}
+		isEqual(myBatch.insert(myBatch.find(30), ft::make_pair(31, 0))->first, stdBatch.insert(stdBatch.find(30), std::make_pair(31, 0))->first);
+		isEqual(myBatch.insert(myBatch.begin(), ft::make_pair(100, 0))->first, stdBatch.insert(stdBatch.begin(), std::make_pair(100, 0))->first);
+		isEqual((--myBatch.end())->first, (--stdBatch.end())->first);
+	}
+
+	{
+		std::cout << "\n\n31. Testing [Vector] insert and erase in the middle of trivially copyable elements:\n";
+		ft::vector<int> myInts;
+		std::vector<int> stdInts;
+		ft::vector<Point> myPoints;
+		std::vector<Point> stdPoints;
+		for (int i = 0; i < 200; ++i)
+		{
+			size_t pos = myInts.size() ? (i * 17) % myInts.size() : 0;
+			size_t pointPos = myPoints.size() ? (i * 13) % myPoints.size() : 0;
+			Point p = { i, -i };
+			if (i % 5 == 4)
+			{
+				myInts.erase(myInts.begin() + pos);
+				stdInts.erase(stdInts.begin() + pos);
+				myPoints.erase(myPoints.begin() + pointPos, myPoints.begin() + pointPos + 1);
+				stdPoints.erase(stdPoints.begin() + pointPos, stdPoints.begin() + pointPos + 1);
+			}
+			else if (i % 5 == 3)
+			{
+				myInts.insert(myInts.begin() + pos, 3, i);
+				stdInts.insert(stdInts.begin() + pos, 3, i);
+				myPoints.insert(myPoints.begin() + pointPos, 2, p);
+				stdPoints.insert(stdPoints.begin() + pointPos, 2, p);
+			}
+			else
+			{
+				myInts.insert(myInts.begin() + pos, i);
+				stdInts.insert(stdInts.begin() + pos, i);
+				myPoints.insert(myPoints.begin() + pointPos, p);
+				stdPoints.insert(stdPoints.begin() + pointPos, p);
+			}
+		}
+		int chunk[] = { 7, 8, 9 };
+		myInts.insert(myInts.begin() + 10, chunk, chunk + 3);
+		stdInts.insert(stdInts.begin() + 10, chunk, chunk + 3);
+		myInts.erase(myInts.begin() + 5, myInts.begin() + 50);
+		stdInts.erase(stdInts.begin() + 5, stdInts.begin() + 50);
+		VectorContentTest(myInts, stdInts);
+		isEqual(myPoints.size(), stdPoints.size());
+		for (size_t i = 0; i < myPoints.size(); ++i)
+		{
+			isEqual(myPoints[i].x, stdPoints[i].x);
+			isEqual(myPoints[i].y, stdPoints[i].y);
+		}
+	}
+
+	{
+		std::cout << "\n\n32. Testing [Vector] growth policies:\n";
+		ft::vector<int, std::allocator<int>, ft::vector_growth_double> myDouble;
+		ft::vector<int, std::allocator<int>, ft::vector_growth_one_and_half> myOneAndHalf;
+		ft::vector<int, std::allocator<int>, ft::vector_growth_golden> myGolden;
+		ft::vector<int, std::allocator<int>, ft::vector_growth_fixed<64> > myFixed;
+		ft::vector<int, std::allocator<int>, ft::vector_growth_size_class> mySizeClass;
+		GrowthPolicyTest(myDouble);
+		GrowthPolicyTest(myOneAndHalf);
+		GrowthPolicyTest(myGolden);
+		GrowthPolicyTest(myFixed);
+		GrowthPolicyTest(mySizeClass);
+		ft::vector<int, std::allocator<int>, ft::vector_growth_golden> myGolden2(myGolden);
+		RelationalTest(myGolden, myGolden2, std::vector<int>(3, 1), std::vector<int>(3, 1));
+		myGolden2.push_back(1);
+		RelationalTest(myGolden, myGolden2, std::vector<int>(3, 1), std::vector<int>(4, 1));
+	}
+
+	{
+		std::cout << "\n\n33. Testing [Vector] growth through a reallocating allocator:\n";
+		ft::vector<int, ft::mmap_allocator<int, 4096> > myInts;
+		std::vector<int> stdInts;
+		int chunk[] = { 1, 2, 3, 4, 5 };
+		for (int i = 0; i < 3000; ++i)
+		{
+			size_t pos = myInts.size() ? (i * 31) % myInts.size() : 0;
+			if (i % 3 == 0)
+			{
+				myInts.insert(myInts.begin() + pos, 4, i);
+				stdInts.insert(stdInts.begin() + pos, 4, i);
+			}
+			else if (i % 3 == 1)
+			{
+				myInts.insert(myInts.begin() + pos, chunk, chunk + 5);
+				stdInts.insert(stdInts.begin() + pos, chunk, chunk + 5);
+			}
+			else
+			{
+				myInts.insert(myInts.begin() + pos, myInts.empty() ? i : myInts[0]);
+				stdInts.insert(stdInts.begin() + pos, stdInts.empty() ? i : stdInts[0]);
+			}
+		}
+		VectorContentTest(myInts, stdInts);
+		myInts.resize(myInts.size() * 2, 42);
+		stdInts.resize(stdInts.size() * 2, 42);
+		VectorContentTest(myInts, stdInts);
+		size_t n = myInts.capacity();
+		myInts.insert(myInts.begin() + 7, n, myInts[3]);
+		stdInts.insert(stdInts.begin() + 7, n, stdInts[3]);
+		VectorContentTest(myInts, stdInts);
+		std::vector<int> big(myInts.capacity() + 100, 9);
+		myInts.assign(big.begin(), big.end());
+		stdInts.assign(big.begin(), big.end());
+		VectorContentTest(myInts, stdInts);
+		n = myInts.capacity() + 100;
+		myInts.assign(n, myInts[0]);
+		stdInts.assign(n, stdInts[0]);
+		VectorContentTest(myInts, stdInts);
+	}
+
+	{
+		std::cout << "\n\n34. Testing [Vector] [Map] huge_page_allocator:\n";
+		ft::vector<int, ft::huge_page_allocator<int, 4096> > myInts;
+		std::vector<int> stdInts;
+		for (int i = 0; i < 100000; ++i)
+		{
+			myInts.push_back(i * 7);
+			stdInts.push_back(i * 7);
+		}
+		myInts.insert(myInts.begin() + 500, 2000, -1);
+		stdInts.insert(stdInts.begin() + 500, 2000, -1);
+		myInts.erase(myInts.begin() + 100, myInts.begin() + 50000);
+		stdInts.erase(stdInts.begin() + 100, stdInts.begin() + 50000);
+		VectorContentTest(myInts, stdInts);
+		ft::vector<int, ft::huge_page_allocator<int, 4096> > myCopy(myInts);
+		VectorContentTest(myCopy, stdInts);
+
+		typedef ft::huge_page_allocator<ft::pair<const int, int>, 4096> hugeAlloc;
+		ft::map<int, int, ft::less<int>, hugeAlloc> myMap;
+		ft::map<int, int, ft::less<int>, hugeAlloc, ft::compact_red_black_tree> myCompact;
+		std::map<int, int> stdMap;
+		for (int i = 0; i < 20000; ++i)
+		{
+			myMap.insert(ft::make_pair((i * 7919) % 30011, i));
+			myCompact.insert(ft::make_pair((i * 7919) % 30011, i));
+			stdMap.insert(std::make_pair((i * 7919) % 30011, i));
+		}
+		for (int i = 0; i < 30011; i += 3)
+		{
+			myMap.erase(i);
+			myCompact.erase(i);
+			stdMap.erase(i);
+		}
+		MapContentTest(myMap, stdMap);
+		MapContentTest(myCompact, stdMap);
+	}
+
+	{
+		std::cout << "\n\n35. Testing [small_vector] inline and heap storage:\n";
+		ft::small_vector<int, 8> mySmall;
+		std::vector<int> stdSmall;
+		for (int i = 0; i < 6; ++i)
+		{
+			mySmall.push_back(i);
+			stdSmall.push_back(i);
+		}
+		isEqual(mySmall.is_inline(), true);
+		VectorContentTest(mySmall, stdSmall);
+		mySmall.insert(mySmall.begin() + 2, 5, -1);
+		stdSmall.insert(stdSmall.begin() + 2, 5, -1);
+		isEqual(mySmall.is_inline(), false);
+		VectorContentTest(mySmall, stdSmall);
+		int chunk[] = { 10, 20, 30 };
+		mySmall.insert(mySmall.begin(), chunk, chunk + 3);
+		stdSmall.insert(stdSmall.begin(), chunk, chunk + 3);
+		mySmall.erase(mySmall.begin() + 1, mySmall.begin() + 4);
+		stdSmall.erase(stdSmall.begin() + 1, stdSmall.begin() + 4);
+		mySmall.erase(mySmall.end() - 1);
+		stdSmall.erase(stdSmall.end() - 1);
+		VectorContentTest(mySmall, stdSmall);
+
+		ft::small_vector<int, 8> myInline(3, 7);
+		std::vector<int> stdInline(3, 7);
+		mySmall.swap(myInline);
+		stdSmall.swap(stdInline);
+		VectorContentTest(mySmall, stdSmall);
+		VectorContentTest(myInline, stdInline);
+		isEqual(mySmall.is_inline(), true);
+
+		ft::small_vector<int, 8> myCopy(myInline);
+		VectorContentTest(myCopy, stdInline);
+		RelationalTest(myCopy, myInline, stdInline, stdInline);
+		myCopy.resize(20, 4);
+		std::vector<int> stdCopy(stdInline);
+		stdCopy.resize(20, 4);
+		VectorContentTest(myCopy, stdCopy);
+		RelationalTest(myCopy, myInline, stdCopy, stdInline);
+		myCopy.assign(2, 9);
+		stdCopy.assign(2, 9);
+		VectorContentTest(myCopy, stdCopy);
+		myCopy.assign(stdInline.begin(), stdInline.end());
+		VectorContentTest(myCopy, stdInline);
+		myCopy.clear();
+		isEqual(myCopy.empty(), true);
+
+		ft::small_vector<std::string, 2> myStrings;
+		std::vector<std::string> stdStrings;
+		for (int i = 0; i < 10; ++i)
+		{
+			std::string str(i + 1, 'a' + i);
+			myStrings.insert(myStrings.begin() + i / 2, str);
+			stdStrings.insert(stdStrings.begin() + i / 2, str);
+		}
+		myStrings.pop_back();
+		stdStrings.pop_back();
+		VectorContentTest(myStrings, stdStrings);
+	}
+
+	{
+		std::cout << "\n\n36. Testing [Deque] [Queue] [Stack]:\n";
+		ft::deque<int> myDeque;
+		std::deque<int> stdDeque;
+		for (int i = 0; i < 3000; ++i)
+		{
+			if (i % 3 == 0)
+			{
+				myDeque.push_front(i);
+				stdDeque.push_front(i);
+			}
+			else
+			{
+				myDeque.push_back(i);
+				stdDeque.push_back(i);
+			}
+		}
+		VectorContentTest(myDeque, stdDeque);
+		myDeque.insert(myDeque.begin() + 100, 300, -1);
+		stdDeque.insert(stdDeque.begin() + 100, 300, -1);
+		myDeque.insert(myDeque.end() - 100, 5, -2);
+		stdDeque.insert(stdDeque.end() - 100, 5, -2);
+		myDeque.erase(myDeque.begin() + 10, myDeque.begin() + 700);
+		stdDeque.erase(stdDeque.begin() + 10, stdDeque.begin() + 700);
+		myDeque.erase(myDeque.end() - 50, myDeque.end() - 20);
+		stdDeque.erase(stdDeque.end() - 50, stdDeque.end() - 20);
+		for (int i = 0; i < 500; ++i)
+		{
+			myDeque.pop_front();
+			stdDeque.pop_front();
+			myDeque.pop_back();
+			stdDeque.pop_back();
+		}
+		VectorContentTest(myDeque, stdDeque);
+		isEqual(myDeque.front(), stdDeque.front());
+		isEqual(myDeque.back(), stdDeque.back());
+		ft::deque<int>::reverse_iterator my_rit = myDeque.rbegin();
+		std::deque<int>::reverse_iterator std_rit = stdDeque.rbegin();
+		isEqual(*(my_rit + 7), *(std_rit + 7));
+		isEqual(myDeque.end() - myDeque.begin(), stdDeque.end() - stdDeque.begin());
+		ft::deque<int> myDeque2(myDeque);
+		std::deque<int> stdDeque2(stdDeque);
+		RelationalTest(myDeque, myDeque2, stdDeque, stdDeque2);
+		myDeque2.resize(10);
+		stdDeque2.resize(10);
+		RelationalTest(myDeque, myDeque2, stdDeque, stdDeque2);
+		myDeque.swap(myDeque2);
+		stdDeque.swap(stdDeque2);
+		VectorContentTest(myDeque, stdDeque);
+		myDeque.assign(40, 3);
+		stdDeque.assign(40, 3);
+		VectorContentTest(myDeque, stdDeque);
+
+		ft::queue<int> myQueue;
+		std::queue<int> stdQueue;
+		for (int i = 0; i < 1000; ++i)
+		{
+			myQueue.push(i);
+			stdQueue.push(i);
+			if (i % 3 == 0)
+			{
+				myQueue.pop();
+				stdQueue.pop();
+			}
+		}
+		isEqual(myQueue.size(), stdQueue.size());
+		isEqual(myQueue.front(), stdQueue.front());
+		isEqual(myQueue.back(), stdQueue.back());
+		ft::queue<int> myQueue2(myQueue);
+		std::queue<int> stdQueue2(stdQueue);
+		myQueue2.pop();
+		stdQueue2.pop();
+		RelationalTest(myQueue, myQueue2, stdQueue, stdQueue2);
+
+		ft::stack<int> myStack;
+		ft::stack<int, ft::vector<int> > myVectorStack;
+		std::stack<int> stdStack;
+		for (int i = 0; i < 1000; ++i)
+		{
+			myStack.push(i * 3);
+			myVectorStack.push(i * 3);
+			stdStack.push(i * 3);
+		}
+		for (int i = 0; i < 400; ++i)
+		{
+			myStack.pop();
+			myVectorStack.pop();
+			stdStack.pop();
+		}
+		isEqual(myStack.size(), stdStack.size());
+		isEqual(myStack.top(), stdStack.top());
+		isEqual(myVectorStack.size(), stdStack.size());
+		isEqual(myVectorStack.top(), stdStack.top());
+		ft::stack<int> myStack2(myStack);
+		std::stack<int> stdStack2(stdStack);
+		myStack2.push(1);
+		stdStack2.push(1);
+		RelationalTest(myStack, myStack2, stdStack, stdStack2);
+	}
+
+	{
+		std::cout << "\n\n37. Testing [incremental_vector] migration:\n";
+		ft::incremental_vector<int> myInc;
+		std::vector<int> stdInc;
+		bool sawMigration = false;
+		for (int i = 0; i < 5000; ++i)
+		{
+			myInc.push_back(i * 11);
+			stdInc.push_back(i * 11);
+			sawMigration = sawMigration || myInc.migrating();
+			if (i % 7 == 6)
+			{
+				myInc.pop_back();
+				stdInc.pop_back();
+			}
+		}
+		isEqual(sawMigration, true);
+		isEqual(myInc.capacity() >= myInc.size(), true);
+		VectorContentTest(myInc, stdInc);
+		isEqual(myInc.front(), stdInc.front());
+		isEqual(myInc.back(), stdInc.back());
+		isEqual(myInc.at(1234), stdInc.at(1234));
+		ft::incremental_vector<int> myCopy(myInc);
+		isEqual(myCopy == myInc, true);
+		myInc.finish_migration();
+		isEqual(myInc.migrating(), false);
+		VectorContentTest(myInc, stdInc);
+		myCopy.pop_back();
+		isEqual(myCopy != myInc, true);
+		myCopy.swap(myInc);
+		isEqual(myCopy.size(), stdInc.size());
+		myInc.clear();
+		isEqual(myInc.empty(), true);
+		bool threw = false;
+		try { myInc.at(0); } catch (const std::out_of_range&) { threw = true; }
+		isEqual(threw, true);
+	}
+
+	{
+		std::cout << "\n\n38. Testing [Algorithm] equal and lexicographical_compare on contiguous iterators:\n";
+		ft::vector<int> myA;
+		ft::small_vector<int, 4> mySmall;
+		std::vector<int> stdA;
+		for (int i = 0; i < 300; ++i)
+		{
+			myA.push_back(i % 17);
+			mySmall.push_back(i % 17);
+			stdA.push_back(i % 17);
+		}
+		ft::vector<int> myB(myA);
+		std::vector<int> stdB(stdA);
+		isEqual(ft::equal(myA.begin(), myA.end(), myB.begin()), std::equal(stdA.begin(), stdA.end(), stdB.begin()));
+		isEqual(ft::equal(mySmall.begin(), mySmall.end(), myA.begin()), true);
+		isEqual(ft::equal(myA.data(), myA.data() + myA.size(), stdA.begin()), true);
+		myB[250] = -1;
+		stdB[250] = -1;
+		isEqual(ft::equal(myA.begin(), myA.end(), myB.begin()), std::equal(stdA.begin(), stdA.end(), stdB.begin()));
+		isEqual(ft::lexicographical_compare(myA.begin(), myA.end(), myB.begin(), myB.end()),
+			std::lexicographical_compare(stdA.begin(), stdA.end(), stdB.begin(), stdB.end()));
+		isEqual(ft::lexicographical_compare(myB.begin(), myB.end(), myA.begin(), myA.end()),
+			std::lexicographical_compare(stdB.begin(), stdB.end(), stdA.begin(), stdA.end()));
+		isEqual(ft::lexicographical_compare(myA.begin(), myA.begin() + 100, myA.begin(), myA.end()),
+			std::lexicographical_compare(stdA.begin(), stdA.begin() + 100, stdA.begin(), stdA.end()));
+		isEqual(ft::lexicographical_compare(mySmall.begin(), mySmall.end(), myA.begin(), myA.end()), false);
+
+		ft::vector<int> myAssigned(5, 1);
+		myAssigned.assign(mySmall.begin(), mySmall.end());
+		VectorContentTest(myAssigned, stdA);
+		int raw[] = { 4, 5, 6, 7 };
+		myAssigned.insert(myAssigned.begin() + 3, raw, raw + 4);
+		stdA.insert(stdA.begin() + 3, raw, raw + 4);
+		VectorContentTest(myAssigned, stdA);
+		ft::vector<int> myFromSmall(mySmall.begin() + 10, mySmall.end() - 10);
+		std::vector<int> stdFromSmall(mySmall.begin() + 10, mySmall.end() - 10);
+		VectorContentTest(myFromSmall, stdFromSmall);
+	}
+
+	{
+		std::cout << "\n\n39. Testing [Vector] [small_vector] insert from input iterators:\n";
+		std::ostringstream small_text;
+		for (int i = 0; i < 50; ++i)
+			small_text << i << ' ';
+		std::ostringstream big_text;
+		for (int i = 0; i < 3000; ++i)
+			big_text << -i << ' ';
+		ft::vector<int> myInts(100, 7);
+		ft::small_vector<int, 16> mySmall(10, 7);
+		std::vector<int> stdInts(100, 7);
+		std::vector<int> stdSmall(10, 7);
+		for (int r = 0; r < 6; ++r)
+		{
+			const std::string& text = r % 3 == 2 ? big_text.str() : small_text.str();
+			size_t pos = (r * 37) % myInts.size();
+			size_t smallPos = (r * 3) % mySmall.size();
+			std::istringstream my_is(text), std_is(text), my_small_is(text), std_small_is(text);
+			myInts.insert(myInts.begin() + pos, std::istream_iterator<int>(my_is), std::istream_iterator<int>());
+			stdInts.insert(stdInts.begin() + pos, std::istream_iterator<int>(std_is), std::istream_iterator<int>());
+			mySmall.insert(mySmall.begin() + smallPos, std::istream_iterator<int>(my_small_is), std::istream_iterator<int>());
+			stdSmall.insert(stdSmall.begin() + smallPos, std::istream_iterator<int>(std_small_is), std::istream_iterator<int>());
+		}
+		VectorContentTest(myInts, stdInts);
+		VectorContentTest(mySmall, stdSmall);
+
+		std::istringstream my_words("tous les chemins menent a rome"), std_words("tous les chemins menent a rome");
+		ft::vector<std::string> myStrings(3, "x");
+		std::vector<std::string> stdStrings(3, "x");
+		myStrings.insert(myStrings.begin() + 1, std::istream_iterator<std::string>(my_words), std::istream_iterator<std::string>());
+		stdStrings.insert(stdStrings.begin() + 1, std::istream_iterator<std::string>(std_words), std::istream_iterator<std::string>());
+		VectorContentTest(myStrings, stdStrings);
+		std::istringstream my_empty(""), std_empty("");
+		myInts.insert(myInts.begin(), std::istream_iterator<int>(my_empty), std::istream_iterator<int>());
+		stdInts.insert(stdInts.begin(), std::istream_iterator<int>(std_empty), std::istream_iterator<int>());
+		VectorContentTest(myInts, stdInts);
+	}
+
+	{
+		std::cout << "\n\n40. Testing [Vector] bulk fill and copy on several threads:\n";
+		ft::set_bulk_parallelism(4, 4096);
+		ft::vector<double> myDoubles;
+		std::vector<double> stdDoubles;
+		myDoubles.assign(100003, 1.5);
+		stdDoubles.assign(100003, 1.5);
+		VectorContentTest(myDoubles, stdDoubles);
+		for (size_t i = 0; i < myDoubles.size(); i += 97)
+		{
+			myDoubles[i] = static_cast<double>(i);
+			stdDoubles[i] = static_cast<double>(i);
+		}
+		ft::vector<double> myCopy(myDoubles);
+		VectorContentTest(myCopy, stdDoubles);
+		myCopy.insert(myCopy.begin() + 33, 50001, -2.5);
+		stdDoubles.insert(stdDoubles.begin() + 33, 50001, -2.5);
+		VectorContentTest(myCopy, stdDoubles);
+		myCopy.reserve(myCopy.capacity() * 2 + 1);
+		VectorContentTest(myCopy, stdDoubles);
+		ft::vector<int> mySmall(100, 3);
+		std::vector<int> stdSmall(100, 3);
+		VectorContentTest(mySmall, stdSmall);
+		ft::set_bulk_parallelism(1);
+	}
+
+	{
+		std::cout << "\n\n41. Testing [Vector] [Map] [Set] erase_if and erase_unordered:\n";
+		ft::vector<int> myInts;
+		std::vector<int> stdInts;
+		ft::map<int, int> myMap;
+		std::map<int, int> stdMap;
+		ft::set<int> mySet;
+		std::set<int> stdSet;
+		for (int i = 0; i < 500; ++i)
+		{
+			int v = (i * 7919) % 1009;
+			myInts.push_back(v);
+			stdInts.push_back(v);
+			myMap.insert(ft::make_pair(v, i));
+			stdMap.insert(std::make_pair(v, i));
+			mySet.insert(v);
+			stdSet.insert(v);
+		}
+		size_t stdErased = stdInts.size();
+		stdInts.erase(std::remove_if(stdInts.begin(), stdInts.end(), isOdd), stdInts.end());
+		stdErased -= stdInts.size();
+		isEqual(ft::erase_if(myInts, isOdd), stdErased);
+		VectorContentTest(myInts, stdInts);
+		isEqual(ft::erase_if(myInts, isOdd), 0u);
+
+		stdErased = 0;
+		for (std::map<int, int>::iterator it = stdMap.begin(); it != stdMap.end();)
+		{
+			if (it->second % 2 != 0)
+			{
+				stdMap.erase(it++);
+				++stdErased;
+			}
+			else
+				++it;
+		}
+		isEqual(ft::erase_if(myMap, hasOddValue), stdErased);
+		MapContentTest(myMap, stdMap);
+
+		stdErased = 0;
+		for (std::set<int>::iterator it = stdSet.begin(); it != stdSet.end();)
+		{
+			if (isOdd(*it))
+			{
+				stdSet.erase(it++);
+				++stdErased;
+			}
+			else
+				++it;
+		}
+		isEqual(ft::erase_if(mySet, isOdd), stdErased);
+		isEqual(mySet.size(), stdSet.size());
+		isEqual(ft::equal(mySet.begin(), mySet.end(), stdSet.begin()), true);
+
+		ft::vector<int> myUnordered;
+		std::vector<int> stdUnordered;
+		for (int i = 0; i < 100; ++i)
+		{
+			myUnordered.push_back(i);
+			stdUnordered.push_back(i);
+		}
+		ft::vector<int>::iterator my_it = myUnordered.erase_unordered(myUnordered.begin() + 10);
+		isEqual(*my_it, 99);
+		my_it = myUnordered.erase_unordered(myUnordered.end() - 1);
+		isEqual(my_it == myUnordered.end(), true);
+		for (int i = 0; i < 20; ++i)
+			myUnordered.erase_unordered(myUnordered.begin() + (i * 13) % myUnordered.size());
+		std::vector<int> mySorted(myUnordered.begin(), myUnordered.end());
+		std::sort(mySorted.begin(), mySorted.end());
+		std::vector<int> stdKept;
+		std::set_intersection(stdUnordered.begin(), stdUnordered.end(), mySorted.begin(), mySorted.end(), std::back_inserter(stdKept));
+		isEqual(myUnordered.size(), 78u);
+		VectorContentTest(mySorted, stdKept);
+		isEqual(std::adjacent_find(mySorted.begin(), mySorted.end()) == mySorted.end(), true);
+	}
+
+	{
+		std::cout << "\n\n42. Testing [Vector<bool>] packed bits:\n";
+		ft::vector<bool> myBits;
+		std::vector<bool> stdBits;
+		for (int i = 0; i < 1000; ++i)
+		{
+			myBits.push_back(i % 3 == 0);
+			stdBits.push_back(i % 3 == 0);
+		}
+		for (int i = 0; i < 40; ++i)
+		{
+			size_t pos = (i * 61) % myBits.size();
+			if (i % 4 == 0)
+			{
+				myBits.erase(myBits.begin() + pos, myBits.begin() + std::min(myBits.size(), pos + i * 3));
+				stdBits.erase(stdBits.begin() + pos, stdBits.begin() + std::min(stdBits.size(), pos + i * 3));
+			}
+			else if (i % 4 == 1)
+			{
+				myBits.insert(myBits.begin() + pos, i * 5, i % 2 == 0);
+				stdBits.insert(stdBits.begin() + pos, i * 5, i % 2 == 0);
+			}
+			else if (i % 4 == 2)
+			{
+				myBits.erase(myBits.begin() + pos);
+				stdBits.erase(stdBits.begin() + pos);
+			}
+			else
+			{
+				myBits.insert(myBits.begin() + pos, stdBits.begin() + 7, stdBits.begin() + 7 + i * 2);
+				stdBits.insert(stdBits.begin() + pos, stdBits.begin() + 7, stdBits.begin() + 7 + i * 2);
+			}
+		}
+		VectorContentTest(myBits, stdBits);
+		isEqual(myBits.count(), static_cast<size_t>(std::count(stdBits.begin(), stdBits.end(), true)));
+		isEqual(myBits.find_first(), static_cast<size_t>(std::find(stdBits.begin(), stdBits.end(), true) - stdBits.begin()));
+		myBits.resize(65, true);
+		stdBits.resize(65, true);
+		myBits.flip();
+		stdBits.flip();
+		VectorContentTest(myBits, stdBits);
+		ft::vector<bool> myRebuilt(stdBits.begin(), stdBits.end());
+		isEqual(myRebuilt == myBits, true);
+		myRebuilt.pop_back();
+		myBits.pop_back();
+		myRebuilt ^= myBits;
+		isEqual(myRebuilt.count(), 0u);
+	}
+
+	{
+		std::cout << "\n\n43. Testing [mmap_vector] file backed storage:\n";
+		char path[] = "/tmp/ft_mmap_vector_XXXXXX";
+		int fd = mkstemp(path);
+		isEqual(fd >= 0, true);
+		close(fd);
+		std::vector<Point> stdPoints;
+		{
+			ft::mmap_vector<Point> myPoints(path, ft::mmap_vector<Point>::truncate);
+			for (int i = 0; i < 5000; ++i)
+			{
+				Point p = { i, i * 2 };
+				myPoints.push_back(p);
+				stdPoints.push_back(p);
+			}
+			Point gap = { -1, -1 };
+			myPoints.insert(myPoints.begin() + 10, 100, gap);
+			stdPoints.insert(stdPoints.begin() + 10, 100, gap);
+			myPoints.erase(myPoints.begin() + 2000, myPoints.begin() + 3000);
+			stdPoints.erase(stdPoints.begin() + 2000, stdPoints.begin() + 3000);
+			isEqual(myPoints.size(), stdPoints.size());
+			isEqual(myPoints.capacity() >= myPoints.size(), true);
+			myPoints.sync();
+		}
+		ft::mmap_vector<Point> myReopened(path, ft::mmap_vector<Point>::read_only);
+		isEqual(myReopened.is_read_only(), true);
+		isEqual(myReopened.size(), stdPoints.size());
+		for (size_t i = 0; i < myReopened.size() && i < stdPoints.size(); i += 7)
+		{
+			isEqual(myReopened[i].x, stdPoints[i].x);
+			isEqual(myReopened[i].y, stdPoints[i].y);
+		}
+		Point extra = { 0, 0 };
+		bool threw = false;
+		try { myReopened.push_back(extra); } catch (const std::logic_error&) { threw = true; }
+		isEqual(threw, true);
+		myReopened.close();
+		isEqual(myReopened.is_open(), false);
+
+		ft::mmap_vector<int> myInts(path, ft::mmap_vector<int>::truncate);
+		std::vector<int> stdInts;
+		for (int i = 0; i < 300; ++i)
+		{
+			myInts.insert(myInts.begin() + (i * 7) % (myInts.size() + 1), i);
+			stdInts.insert(stdInts.begin() + (i * 7) % (stdInts.size() + 1), i);
+		}
+		VectorContentTest(myInts, stdInts);
+		myInts.resize(20);
+		stdInts.resize(20);
+		VectorContentTest(myInts, stdInts);
+		myInts.close();
+		std::remove(path);
+	}
+
+	{
+		std::cout << "\n\n44. Testing [Vector] append_from_fd and append_from_stream:\n";
+		std::vector<int> source;
+		for (int i = 0; i < 1000; ++i)
+			source.push_back(i * 3 - 500);
+		int fds[2];
+		isEqual(pipe(fds), 0);
+		size_t bytes = 999 * sizeof(int) + 2;
+		isEqual(write(fds[1], &source[0], bytes), static_cast<ssize_t>(bytes));
+		close(fds[1]);
+		ft::vector<int> myInts(1, 42);
+		std::vector<int> stdInts(1, 42);
+		isEqual(myInts.append_from_fd(fds[0], 2000), 999u);
+		close(fds[0]);
+		stdInts.insert(stdInts.end(), source.begin(), source.begin() + 999);
+		VectorContentTest(myInts, stdInts);
+		bool threw = false;
+		try { myInts.append_from_fd(-1, 10); } catch (const std::runtime_error&) { threw = true; }
+		isEqual(threw, true);
+		isEqual(myInts.size(), stdInts.size());
+
+		std::string raw(reinterpret_cast<const char*>(&source[0]), source.size() * sizeof(int));
+		std::istringstream is(raw);
+		isEqual(myInts.append_from_stream(is, 600), 600u);
+		stdInts.insert(stdInts.end(), source.begin(), source.begin() + 600);
+		isEqual(myInts.append_from_stream(is, 600), 400u);
+		stdInts.insert(stdInts.end(), source.begin() + 600, source.end());
+		isEqual(is.fail(), true);
+		VectorContentTest(myInts, stdInts);
+	}
+
+	{
+		std::cout << "\n\n45. Testing [span] views over contiguous containers:\n";
+		ft::vector<int> myInts;
+		std::vector<int> stdInts;
+		for (int i = 0; i < 40; ++i)
+		{
+			myInts.push_back(i * i);
+			stdInts.push_back(i * i);
+		}
+		ft::span<int> all(myInts);
+		VectorContentTest(all, stdInts);
+		VectorContentTest(all.first(10), std::vector<int>(stdInts.begin(), stdInts.begin() + 10));
+		VectorContentTest(all.last(7), std::vector<int>(stdInts.end() - 7, stdInts.end()));
+		VectorContentTest(all.subspan(5, 12), std::vector<int>(stdInts.begin() + 5, stdInts.begin() + 17));
+		VectorContentTest(all.subspan(30), std::vector<int>(stdInts.begin() + 30, stdInts.end()));
+		isEqual(all.subspan(40).empty(), true);
+		isEqual(all.first(0).size(), 0u);
+		all[3] = -3;
+		stdInts[3] = -3;
+		isEqual(myInts[3], stdInts[3]);
+		isEqual(all.size_bytes(), stdInts.size() * sizeof(int));
+		isEqual(*all.rbegin(), stdInts.back());
+		isEqual(ft::equal(all.begin(), all.end(), stdInts.begin()), true);
+		bool threw = false;
+		try { all.at(40); } catch (const std::out_of_range&) { threw = true; }
+		isEqual(threw, true);
+
+		const ft::vector<int>& constInts = myInts;
+		ft::span<const int> constView(constInts);
+		VectorContentTest(constView, stdInts);
+		ft::small_vector<int, 8> mySmall(5, 9);
+		ft::span<int> smallView(mySmall);
+		VectorContentTest(smallView, std::vector<int>(5, 9));
+		int array[] = { 1, 2, 3, 4 };
+		ft::span<int> arrayView(array);
+		ft::span<int> rangeView(array + 1, array + 3);
+		isEqual(arrayView.size(), 4u);
+		isEqual(rangeView.front(), 2);
+		isEqual(rangeView.back(), 3);
+		ft::span<int> copyView(all.subspan(2, 3));
+		copyView = arrayView;
+		isEqual(copyView.data() == array, true);
+		isEqual(spanOrOther(myInts), 40);
+		isEqual(spanOrOther(std::set<int>()), -1);
+	}
+
+	{
+		std::cout << "\n\n46. Testing [Vector] resize_default_init:\n";
+		ft::vector<int> myInts(3, 5);
+		std::vector<int> stdInts(3, 5);
+		myInts.resize_default_init(1000);
+		stdInts.resize(1000);
+		isEqual(myInts.size(), stdInts.size());
+		isEqual(myInts.capacity() >= 1000, true);
+		for (size_t i = 3; i < myInts.size(); ++i)
+		{
+			myInts[i] = static_cast<int>(i);
+			stdInts[i] = static_cast<int>(i);
+		}
+		VectorContentTest(myInts, stdInts);
+		myInts.resize_default_init(10);
+		stdInts.resize(10);
+		VectorContentTest(myInts, stdInts);
+		ft::vector<Point> myPoints;
+		myPoints.resize_default_init(64);
+		isEqual(myPoints.size(), 64u);
+	}
+
+#if __cplusplus >= 201103L
+	{
+		std::cout << "\n\n47. Testing [Vector] move and emplace (C++11):\n";
+		ft::vector<std::string> myStrings;
+		std::vector<std::string> stdStrings;
+		for (int i = 0; i < 50; ++i)
+		{
+			std::string myStr(i + 20, 'a' + i % 26);
+			std::string stdStr(myStr);
+			myStrings.push_back(std::move(myStr));
+			stdStrings.push_back(std::move(stdStr));
+		}
+		myStrings.emplace_back(5, 'z');
+		stdStrings.emplace_back(5, 'z');
+		myStrings.emplace(myStrings.begin() + 3, 4, 'y');
+		stdStrings.emplace(stdStrings.begin() + 3, 4, 'y');
+		myStrings.emplace_back(myStrings[0]);
+		stdStrings.emplace_back(stdStrings[0]);
+		VectorContentTest(myStrings, stdStrings);
+		ft::vector<std::string> myMoved(std::move(myStrings));
+		isEqual(myStrings.empty(), true);
+		VectorContentTest(myMoved, stdStrings);
+		myStrings = std::move(myMoved);
+		isEqual(myMoved.empty(), true);
+		VectorContentTest(myStrings, stdStrings);
+	}
+#endif
+
+	{
+		std::cout << "\n\n48. Testing [Algorithm] equal and lexicographical_compare on arithmetic types:\n";
+		CompareKernelTest<char>('a', 'b');
+		CompareKernelTest<signed char>(1, -1);
+		CompareKernelTest<unsigned char>(1, 200);
+		CompareKernelTest<short>(-5, 300);
+		CompareKernelTest<int>(7, -7);
+		CompareKernelTest<unsigned int>(7, 4000000000u);
+		CompareKernelTest<long>(-1, 1);
+		CompareKernelTest<float>(1.5f, -2.5f);
+		CompareKernelTest<double>(0.0, -0.0);
+		CompareKernelTest<double>(1.0, std::numeric_limits<double>::quiet_NaN());
+		CompareKernelTest<float>(std::numeric_limits<float>::quiet_NaN(), 1.0f);
+	}
+
+	{
+		std::cout << "\n\n49. Testing [Map] [Set] compact_red_black_tree keeps references across inserts:\n";
+		typedef ft::map<int, std::string, ft::less<int>, std::allocator<ft::pair<const int, std::string> >, ft::compact_red_black_tree> compactMap;
+		compactMap myMap;
+		std::map<int, std::string> stdMap;
+		myMap[0] = std::string(40, 'r');
+		stdMap[0] = std::string(40, 'r');
+		std::string& ref = myMap[0];
+		const std::string* ptr = &myMap[0];
+		compactMap::iterator it = myMap.find(0);
+		for (int i = 1; i < 500; ++i)
+		{
+			myMap[i] = std::string(i % 50 + 20, 'a' + i % 26);
+			stdMap[i] = std::string(i % 50 + 20, 'a' + i % 26);
+		}
+		for (int i = 1000; i < 1200; ++i)
+		{
+			myMap[i] = myMap[i - 900];
+			stdMap[i] = stdMap[i - 900];
+		}
+		isEqual(ref, stdMap[0]);
+		isEqual(ptr == &myMap[0], true);
+		isEqual(&*it == &*myMap.begin(), true);
+		for (int i = 1; i < 300; i += 2)
+		{
+			myMap.erase(i);
+			stdMap.erase(i);
+		}
+		for (int i = 2000; i < 2300; ++i)
+		{
+			myMap[i] = "reused";
+			stdMap[i] = "reused";
+		}
+		isEqual(ptr == &myMap[0], true);
+		MapContentTest(myMap, stdMap);
+		compactMap myCopy(myMap);
+		MapContentTest(myCopy, stdMap);
+
+		ft::set<int, ft::less<int>, std::allocator<int>, ft::compact_red_black_tree> mySet;
+		const int& first = *mySet.insert(42).first;
+		for (int i = 0; i < 1000; ++i)
+			mySet.insert(i * 3);
+		isEqual(&first == &*mySet.find(42), true);
+		isEqual(first, 42);
+	}
+
+#if __cplusplus >= 201103L
+	{
+		std::cout << "\n\n50. Testing [Vector] move assignment hands over the allocator (C++11):\n";
+		{
+			ft::vector<int, TaggedAllocator<int> > myTarget(10, 1, TaggedAllocator<int>(1));
+			ft::vector<int, TaggedAllocator<int> > mySource(20, 2, TaggedAllocator<int>(2));
+			myTarget = std::move(mySource);
+			isEqual(myTarget.get_allocator().id, 2);
+			VectorContentTest(myTarget, std::vector<int>(20, 2));
+			myTarget.push_back(3);
+
+			ft::vector<bool, TaggedAllocator<bool> > myBitsTarget(100, true, TaggedAllocator<bool>(3));
+			ft::vector<bool, TaggedAllocator<bool> > myBitsSource(300, false, TaggedAllocator<bool>(4));
+			myBitsTarget = std::move(myBitsSource);
+			isEqual(myBitsTarget.get_allocator().id, 4);
+			isEqual(myBitsTarget.size(), 300u);
+			myBitsTarget.push_back(true);
+		}
+		isEqual(TaggedAllocator<int>::mismatches(), 0);
+		isEqual(TaggedAllocator<unsigned long>::mismatches(), 0);
+	}
+#endif
+
 	std::cout << "\n\n";
 	return 0;
 }
@@ -15,10 +15,18 @@
 #endif
 
 namespace ft {
+	/**
+	 * @tparam Tree ft::red_black_tree (default), ft::splay_tree or
+	 * ft::compact_red_black_tree. Any other Tree needs their interface:
+	 * the iterator typedefs, begin/end/rbegin/rend, size, insert (value,
+	 * hint, range), insert_sorted_batch, insert_parallel, erase, swap,
+	 * clear, find and get_allocator.
+	 */
 	template<typename Key,
 			typename T,
 			typename Compare = ft::less<Key>,
-			typename Allocator = std::allocator<ft::pair<const Key, T> > >
+			typename Allocator = std::allocator<ft::pair<const Key, T> >,
+			template<typename, typename, typename> class Tree = ft::red_black_tree>
 	class map {
 	public:
 		typedef Key													key_type;
@@ -34,7 +42,7 @@ namespace ft {
 		typedef std::size_t											size_type;
 
 		class value_compare : public ft::binary_function<value_type, value_type, bool> {
-			friend class map<Key, T, Compare, Allocator>;
+			friend class map<Key, T, Compare, Allocator, Tree>;
 
 			protected:
 				key_compare comp;
@@ -47,7 +55,7 @@ namespace ft {
 		};
 
 	private:
-		typedef ft::red_black_tree<value_type, value_compare, allocator_type>	tree_type;
+		typedef Tree<value_type, value_compare, allocator_type>					tree_type;
 
 	public:
 		typedef typename tree_type::iterator						iterator;
@@ -72,7 +80,7 @@ namespace ft {
 		}
 
 		map(const map& x) :
-			_comp(key_compare()),
+			_comp(x._comp),
 			_tree_data(x._tree_data) {
 			MAP_DEBUG("map copy constructor called");
 		}
@@ -151,10 +159,8 @@ namespace ft {
 			return this->_tree_data.insert(val);
 		}
 
-		// @note: ignore position hint for now (minimal performance lost)
 		iterator insert(iterator position, const value_type& val) {
-			(void)position;
-			return this->_tree_data.insert(val).first;
+			return this->_tree_data.insert(position, val).first;
 		}
 
 		template<typename InputIterator>
@@ -162,6 +168,40 @@ namespace ft {
 			this->_tree_data.insert(first, last);
 		}
 
+		/**
+		 * @brief Insert an unsorted range by sorting it on several threads
+		 * and rebuilding the tree in one pass. Worth it for large bulk loads.
+		 * @param workers number of sorting threads, 0 for one per cpu
+		 */
+		template<typename InputIterator>
+		void insert_parallel(InputIterator first, InputIterator last, size_type workers = 0) {
+			this->_tree_data.insert_parallel(first, last, workers);
+		}
+
+		/**
+		 * @brief Insert a range sorted by key, each search starting from
+		 * the previously inserted element. Existing keys are left as is.
+		 */
+		template<typename InputIterator>
+		void insert_sorted_batch(InputIterator first, InputIterator last) {
+			this->_tree_data.insert_sorted_batch(first, last);
+		}
+
+		/**
+		 * @brief Same as insert_sorted_batch but existing keys get their
+		 * mapped value overwritten.
+		 */
+		template<typename InputIterator>
+		void upsert_sorted_batch(InputIterator first, InputIterator last) {
+			iterator hint = this->end();
+			for (; first != last; ++first) {
+				ft::pair<iterator, bool> ret = this->_tree_data.insert(hint, *first);
+				if (!ret.second)
+					ret.first->second = first->second;
+				hint = ret.first;
+			}
+		}
+
 		void erase(iterator position) {
 			this->_tree_data.erase(position);
 		}
@@ -186,7 +226,7 @@ namespace ft {
 		// observers
 
 		key_compare key_comp() const {
-			return key_compare();
+			return this->_comp;
 		}
 
 		value_compare value_comp() const {
@@ -266,42 +306,62 @@ namespace ft {
 		tree_type _tree_data;
 	};
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	/**
+	 * @brief Erase every element for which pred is true in one in-order
+	 * walk. Each match is unlinked where the walk stands, erasing never
+	 * invalidates the other nodes so the walk just steps past it, no key
+	 * is searched again. pred is called once per element.
+	 * @return number of elements erased
+	 */
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree, typename Predicate>
+	typename map<Key, T, Compare, Alloc, Tree>::size_type erase_if(map<Key, T, Compare, Alloc, Tree>& c, Predicate pred) {
+		typename map<Key, T, Compare, Alloc, Tree>::size_type old_size = c.size();
+		typename map<Key, T, Compare, Alloc, Tree>::iterator it = c.begin();
+		while (it != c.end()) {
+			if (pred(*it))
+				c.erase(it++);
+			else
+				++it;
+		}
+		return old_size - c.size();
+	}
+
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator==(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		if (lhs.size() == rhs.size())
 			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		return false;
 	}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator!=(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		return !(lhs == rhs);
 	}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator<(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator<=(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		return !(rhs < lhs);
 	}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator>(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		return rhs < lhs;
 	}
 
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	bool operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator>=(const map<Key, T, Compare, Alloc, Tree>& lhs, const map<Key, T, Compare, Alloc, Tree>& rhs) {
 		return !(lhs < rhs);
 	}
 }
 
 namespace std {
-	template<typename Key, typename T, typename Compare, typename Alloc>
-	void swap(ft::map<Key, T, Compare, Alloc>& x, ft::map<Key, T, Compare, Alloc>& y) {
+	template<typename Key, typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	void swap(ft::map<Key, T, Compare, Alloc, Tree>& x, ft::map<Key, T, Compare, Alloc, Tree>& y) {
 		x.swap(y);
 	}
 }
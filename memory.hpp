@@ -0,0 +1,420 @@
+#pragma once
+
+#include "type_traits.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <pthread.h>
+#include <sys/mman.h>
+
+namespace ft {
+	/**
+	 * @brief Single background thread that destroys objects handed to it.
+	 * The thread is started on the first job and then lives for the rest
+	 * of the program, waiting for more.
+	 * @note Template only so the static members can be defined in a header.
+	 */
+	template<typename Dummy = void>
+	struct _reclaimer {
+		struct job {
+			void* object;
+			void (*destroy)(void*);
+			job* next;
+		};
+
+		static pthread_mutex_t mutex;
+		static pthread_cond_t ready;
+		static pthread_cond_t idle;
+		static job* head;
+		static job* tail;
+		static bool running;
+		static std::size_t pending;
+
+		static void* work(void*) {
+			pthread_mutex_lock(&mutex);
+			for (;;) {
+				while (head == NULL)
+					pthread_cond_wait(&ready, &mutex);
+				job* current = head;
+				head = current->next;
+				if (head == NULL)
+					tail = NULL;
+				pthread_mutex_unlock(&mutex);
+				current->destroy(current->object);
+				delete current;
+				pthread_mutex_lock(&mutex);
+				if (--pending == 0)
+					pthread_cond_broadcast(&idle);
+			}
+			return NULL;
+		}
+
+		/**
+		 * @brief Queue object for destruction on the reclaimer thread
+		 * @return false if the thread couldn't be started, the object is
+		 * then left to the caller
+		 */
+		static bool push(void* object, void (*destroy)(void*)) {
+			job* new_job = new job;
+			new_job->object = object;
+			new_job->destroy = destroy;
+			new_job->next = NULL;
+			pthread_mutex_lock(&mutex);
+			if (!running) {
+				pthread_t thread;
+				if (pthread_create(&thread, NULL, &_reclaimer::work, NULL) != 0) {
+					pthread_mutex_unlock(&mutex);
+					delete new_job;
+					return false;
+				}
+				pthread_detach(thread);
+				running = true;
+			}
+			if (tail == NULL)
+				head = new_job;
+			else
+				tail->next = new_job;
+			tail = new_job;
+			++pending;
+			pthread_cond_signal(&ready);
+			pthread_mutex_unlock(&mutex);
+			return true;
+		}
+
+		static void wait() {
+			pthread_mutex_lock(&mutex);
+			while (pending != 0)
+				pthread_cond_wait(&idle, &mutex);
+			pthread_mutex_unlock(&mutex);
+		}
+	};
+
+	template<typename Dummy>
+	pthread_mutex_t _reclaimer<Dummy>::mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	template<typename Dummy>
+	pthread_cond_t _reclaimer<Dummy>::ready = PTHREAD_COND_INITIALIZER;
+
+	template<typename Dummy>
+	pthread_cond_t _reclaimer<Dummy>::idle = PTHREAD_COND_INITIALIZER;
+
+	template<typename Dummy>
+	typename _reclaimer<Dummy>::job* _reclaimer<Dummy>::head = NULL;
+
+	template<typename Dummy>
+	typename _reclaimer<Dummy>::job* _reclaimer<Dummy>::tail = NULL;
+
+	template<typename Dummy>
+	bool _reclaimer<Dummy>::running = false;
+
+	template<typename Dummy>
+	std::size_t _reclaimer<Dummy>::pending = 0;
+
+	template<typename Container>
+	void _destroy_container(void* container) {
+		delete static_cast<Container*>(container);
+	}
+
+	// Detects ordered containers (map, set), which are built from a
+	// comparator and an allocator
+	template<typename T>
+	struct _has_key_compare {
+		private:
+			template<typename _T>
+			static char _test(typename _T::key_compare* = 0);
+			template<typename _T>
+			static int _test(...);
+
+		public:
+			static const bool value = sizeof(_test<T>(0)) == 1;
+	};
+
+	template<typename T>
+	const bool _has_key_compare<T>::value;
+
+	/**
+	 * @brief New empty container with the comparator and allocator of c,
+	 * so swapping with c hands over elements the copy can free
+	 */
+	template<typename Container>
+	Container* _new_empty_like(const Container& c, ft::true_type) {
+		return new Container(c.key_comp(), c.get_allocator());
+	}
+
+	template<typename Container>
+	Container* _new_empty_like(const Container& c, ft::false_type) {
+		return new Container(c.get_allocator());
+	}
+
+	/**
+	 * @brief Empty a container right away and free its elements on a
+	 * background thread.
+	 * Works with any container that has swap(), get_allocator() and a
+	 * constructor from its allocator, or from its comparator and allocator
+	 * when it has a key_compare (vector, deque, map, set, ...). On return
+	 * c is empty and can be reused, so destroying a huge container costs
+	 * the caller one swap.
+	 * @note If the reclaimer can't take the job, c is destroyed on the
+	 * calling thread instead.
+	 * @note Element destructors and the allocator run on another thread,
+	 * so they must not rely on the calling thread.
+	 */
+	template<typename Container>
+	void deferred_destroy(Container& c) {
+		Container* victim = ft::_new_empty_like(c, ft::integral_constant<bool, _has_key_compare<Container>::value>());
+		victim->swap(c);
+		bool queued = false;
+		try {
+			queued = _reclaimer<>::push(victim, &_destroy_container<Container>);
+		} catch (...) {
+		}
+		if (!queued)
+			delete victim;
+	}
+
+	/**
+	 * @brief Block until every container given to deferred_destroy is freed
+	 */
+	inline void deferred_destroy_wait() {
+		_reclaimer<>::wait();
+	}
+
+	/**
+	 * @brief Allocator that maps blocks of at least Threshold bytes straight
+	 * from the kernel with mmap and can grow them with mremap.
+	 * Smaller blocks come from operator new like std::allocator.
+	 * @note reallocate() moves raw bytes, containers only use it for
+	 * trivially copyable elements (see allocator_can_reallocate).
+	 */
+	template<typename T, std::size_t Threshold = 1024 * 1024>
+	class mmap_allocator {
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template<typename U>
+		struct rebind {
+			typedef mmap_allocator<U, Threshold> other;
+		};
+
+	public:
+		mmap_allocator() {}
+
+		mmap_allocator(const mmap_allocator&) {}
+
+		template<typename U>
+		mmap_allocator(const mmap_allocator<U, Threshold>&) {}
+
+		~mmap_allocator() {}
+
+		pointer address(reference x) const {
+			return &x;
+		}
+
+		const_pointer address(const_reference x) const {
+			return &x;
+		}
+
+		pointer allocate(size_type n, const void* hint = 0) {
+			(void)hint;
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			if (!mmap_allocator::isMapped(n))
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			void* p = mmap(NULL, n * sizeof(T), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			return static_cast<pointer>(p);
+		}
+
+		void deallocate(pointer p, size_type n) {
+			if (p == NULL)
+				return;
+			if (mmap_allocator::isMapped(n))
+				munmap(p, n * sizeof(T));
+			else
+				::operator delete(p);
+		}
+
+		/**
+		 * @brief Grow or shrink a block from old_n to new_n elements keeping
+		 * its bytes. When both sizes are mapped the kernel moves the pages
+		 * (mremap) instead of copying them.
+		 * @exception bad_alloc, p is left untouched (Strong guarantee)
+		 */
+		pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+			if (p == NULL)
+				return this->allocate(new_n);
+		#ifdef MREMAP_MAYMOVE
+			if (mmap_allocator::isMapped(old_n) && mmap_allocator::isMapped(new_n)) {
+				if (new_n > this->max_size())
+					throw std::bad_alloc();
+				void* q = mremap(p, old_n * sizeof(T), new_n * sizeof(T), MREMAP_MAYMOVE);
+				if (q == MAP_FAILED)
+					throw std::bad_alloc();
+				return static_cast<pointer>(q);
+			}
+		#endif
+			pointer q = this->allocate(new_n);
+			std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), (old_n < new_n ? old_n : new_n) * sizeof(T));
+			this->deallocate(p, old_n);
+			return q;
+		}
+
+		size_type max_size() const {
+			return static_cast<size_type>(-1) / sizeof(T);
+		}
+
+		void construct(pointer p, const_reference val) {
+			new(static_cast<void*>(p)) T(val);
+		}
+
+		void destroy(pointer p) {
+			p->~T();
+		}
+
+	private:
+		static bool isMapped(size_type n) {
+			return n * sizeof(T) >= Threshold;
+		}
+	};
+
+	template<typename T1, typename T2, std::size_t Threshold>
+	bool operator==(const mmap_allocator<T1, Threshold>&, const mmap_allocator<T2, Threshold>&) {
+		return true;
+	}
+
+	template<typename T1, typename T2, std::size_t Threshold>
+	bool operator!=(const mmap_allocator<T1, Threshold>&, const mmap_allocator<T2, Threshold>&) {
+		return false;
+	}
+
+	/**
+	 * @brief Allocator that backs blocks of at least Threshold bytes with
+	 * 2MB aligned anonymous mappings and asks the kernel for transparent
+	 * huge pages (madvise MADV_HUGEPAGE), cutting TLB misses on random
+	 * access into large vectors and node arenas.
+	 * Smaller blocks come from operator new like std::allocator.
+	 * @note Mapped blocks are rounded up to whole huge pages.
+	 */
+	template<typename T, std::size_t Threshold = 2 * 1024 * 1024>
+	class huge_page_allocator {
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template<typename U>
+		struct rebind {
+			typedef huge_page_allocator<U, Threshold> other;
+		};
+
+		static const std::size_t huge_page_size = 2 * 1024 * 1024;
+
+	public:
+		huge_page_allocator() {}
+
+		huge_page_allocator(const huge_page_allocator&) {}
+
+		template<typename U>
+		huge_page_allocator(const huge_page_allocator<U, Threshold>&) {}
+
+		~huge_page_allocator() {}
+
+		pointer address(reference x) const {
+			return &x;
+		}
+
+		const_pointer address(const_reference x) const {
+			return &x;
+		}
+
+		/**
+		 * @brief Map one huge page more than needed and unmap the unaligned
+		 * head and the tail so the block starts on a huge page boundary
+		 */
+		pointer allocate(size_type n, const void* hint = 0) {
+			(void)hint;
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			if (!huge_page_allocator::isMapped(n))
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			std::size_t length = huge_page_allocator::mappedLength(n);
+			void* p = mmap(NULL, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			char* raw = static_cast<char*>(p);
+			char* aligned = reinterpret_cast<char*>((reinterpret_cast<std::size_t>(raw) + huge_page_size - 1) & ~(huge_page_size - 1));
+			std::size_t head = aligned - raw;
+			if (head != 0)
+				munmap(raw, head);
+			munmap(aligned + length, huge_page_size - head);
+		#ifdef MADV_HUGEPAGE
+			madvise(aligned, length, MADV_HUGEPAGE);
+		#endif
+			return reinterpret_cast<pointer>(aligned);
+		}
+
+		void deallocate(pointer p, size_type n) {
+			if (p == NULL)
+				return;
+			if (huge_page_allocator::isMapped(n))
+				munmap(p, huge_page_allocator::mappedLength(n));
+			else
+				::operator delete(p);
+		}
+
+		size_type max_size() const {
+			return (static_cast<size_type>(-1) - 2 * huge_page_size) / sizeof(T);
+		}
+
+		void construct(pointer p, const_reference val) {
+			new(static_cast<void*>(p)) T(val);
+		}
+
+		void destroy(pointer p) {
+			p->~T();
+		}
+
+	private:
+		static bool isMapped(size_type n) {
+			return n * sizeof(T) >= Threshold;
+		}
+
+		static std::size_t mappedLength(size_type n) {
+			return (n * sizeof(T) + huge_page_size - 1) & ~(huge_page_size - 1);
+		}
+	};
+
+	template<typename T, std::size_t Threshold>
+	const std::size_t huge_page_allocator<T, Threshold>::huge_page_size;
+
+	template<typename T1, typename T2, std::size_t Threshold>
+	bool operator==(const huge_page_allocator<T1, Threshold>&, const huge_page_allocator<T2, Threshold>&) {
+		return true;
+	}
+
+	template<typename T1, typename T2, std::size_t Threshold>
+	bool operator!=(const huge_page_allocator<T1, Threshold>&, const huge_page_allocator<T2, Threshold>&) {
+		return false;
+	}
+
+	// allocator_can_reallocate
+	// Allocators with a reallocate(p, old_n, new_n) that keeps the bytes,
+	// containers use it to grow trivially copyable storage in place
+	template<typename Allocator>
+	struct allocator_can_reallocate : public false_type {};
+
+	template<typename T, std::size_t Threshold>
+	struct allocator_can_reallocate<mmap_allocator<T, Threshold> > : public true_type {};
+}
@@ -0,0 +1,507 @@
+#pragma once
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ft {
+	/**
+	 * @brief Vector of trivially copyable elements stored in a file mapped
+	 * with mmap (MAP_SHARED). Opening maps the file as is, nothing is read
+	 * until it is touched, so multi-GB tables load instantly and can be
+	 * bigger than RAM. Growth extends the file with ftruncate and the
+	 * mapping with mremap.
+	 * The file holds the raw elements: after close() its length is exactly
+	 * size() * sizeof(T), while open it may be longer, up to capacity().
+	 * @note Not copyable, the mapping is owned by one vector.
+	 * @note Writing through a reference of a read_only vector faults, the
+	 * modifiers check and throw std::logic_error instead.
+	 */
+	template<typename T, typename GrowthPolicy = ft::vector_growth_double>
+	class mmap_vector {
+	public:
+		typedef T													value_type;
+		typedef T&													reference;
+		typedef const T&											const_reference;
+		typedef T*													pointer;
+		typedef const T*											const_pointer;
+		typedef ft::pointer_iterator<pointer, mmap_vector>			iterator;
+		typedef ft::pointer_iterator<const_pointer, mmap_vector>	const_iterator;
+		typedef ft::rai_reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::rai_reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t										difference_type;
+		typedef std::size_t											size_type;
+
+		enum open_mode {
+			read_only,	// map the existing file, no modification
+			read_write,	// map the file, create it if missing
+			truncate	// same as read_write but start empty
+		};
+
+	public:
+		// construct/copy/destroy
+
+		/**
+		 * @brief Creates a vector with no file, open() must be called before
+		 * adding elements
+		 */
+		mmap_vector() :
+			_fd(-1),
+			_mode(read_only),
+			_storage_start(0),
+			_size(0),
+			_capacity(0) {
+			(void)sizeof(ft::compile_time_check<ft::is_trivially_copyable<T>::value>);
+		}
+
+		/**
+		 * @brief Map path, see open()
+		 */
+		explicit mmap_vector(const char* path, open_mode mode = read_write) :
+			_fd(-1),
+			_mode(read_only),
+			_storage_start(0),
+			_size(0),
+			_capacity(0) {
+			(void)sizeof(ft::compile_time_check<ft::is_trivially_copyable<T>::value>);
+			this->open(path, mode);
+		}
+
+		/**
+		 * @brief Closes the file, see close()
+		 */
+		~mmap_vector() {
+			try {
+				this->close();
+			} catch (...) {
+			}
+		}
+
+		// file
+
+		/**
+		 * @brief Map path in place of the current file (which is closed).
+		 * Every sizeof(T) bytes of the file become an element, no data is
+		 * read before it is accessed.
+		 * @throw std::runtime_error if the file can't be opened or its
+		 * length is not a multiple of sizeof(T), std::bad_alloc if it can't
+		 * be mapped.
+		 */
+		void open(const char* path, open_mode mode = read_write) {
+			this->close();
+			int flags = mode == read_only ? O_RDONLY : O_RDWR | O_CREAT;
+			if (mode == truncate)
+				flags |= O_TRUNC;
+			int fd = ::open(path, flags, 0644);
+			if (fd < 0)
+				mmap_vector::fail("mmap_vector: open");
+			struct stat st;
+			if (fstat(fd, &st) != 0) {
+				::close(fd);
+				mmap_vector::fail("mmap_vector: fstat");
+			}
+			size_type bytes = static_cast<size_type>(st.st_size);
+			if (bytes % sizeof(T) != 0) {
+				::close(fd);
+				throw std::runtime_error("mmap_vector: file length is not a multiple of the element size");
+			}
+			pointer p = 0;
+			if (bytes != 0) {
+				void* q = mmap(NULL, bytes, mode == read_only ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+				if (q == MAP_FAILED) {
+					::close(fd);
+					throw std::bad_alloc();
+				}
+				p = static_cast<pointer>(q);
+			}
+			this->_fd = fd;
+			this->_mode = mode;
+			this->_storage_start = p;
+			this->_size = bytes / sizeof(T);
+			this->_capacity = this->_size;
+		}
+
+		/**
+		 * @brief Unmap and close the file, cutting it to size() elements.
+		 * Nothing is flushed synchronously, the kernel writes dirty pages
+		 * back on its own (see sync()).
+		 */
+		void close() {
+			if (this->_fd < 0)
+				return;
+			if (this->_storage_start != 0)
+				munmap(this->_storage_start, this->_capacity * sizeof(T));
+			int ret = 0;
+			if (this->_mode != read_only)
+				ret = ftruncate(this->_fd, static_cast<off_t>(this->_size * sizeof(T)));
+			::close(this->_fd);
+			this->_fd = -1;
+			this->_mode = read_only;
+			this->_storage_start = 0;
+			this->_size = 0;
+			this->_capacity = 0;
+			if (ret != 0)
+				mmap_vector::fail("mmap_vector: ftruncate");
+		}
+
+		bool is_open() const {
+			return this->_fd >= 0;
+		}
+
+		bool is_read_only() const {
+			return this->_mode == read_only;
+		}
+
+		/**
+		 * @brief Block until the elements are written to the file (msync)
+		 * @throw std::runtime_error if the kernel reports a write error
+		 */
+		void sync() {
+			if (this->_storage_start == 0 || this->_mode == read_only)
+				return;
+			if (msync(this->_storage_start, this->_capacity * sizeof(T), MS_SYNC) != 0)
+				mmap_vector::fail("mmap_vector: msync");
+		}
+
+		// iterators
+
+		iterator begin() {
+			return iterator(this->_storage_start);
+		}
+
+		const_iterator begin() const {
+			return const_iterator(this->_storage_start);
+		}
+
+		iterator end() {
+			return iterator(this->_storage_start + this->_size);
+		}
+
+		const_iterator end() const {
+			return const_iterator(this->_storage_start + this->_size);
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(this->begin());
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			return static_cast<size_type>(-1) / 2 / sizeof(T);
+		}
+
+		void resize(size_type n, value_type val = value_type()) {
+			if (n < this->_size)
+				this->erase(this->begin() + n, this->end());
+			else if (n > this->_size)
+				this->insert(this->end(), n - this->_size, val);
+		}
+
+		size_type capacity() const {
+			return this->_capacity;
+		}
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		/**
+		 * @brief Grow the file and the mapping to n elements
+		 * @throw std::length_error if n exceeds max_size().
+		 */
+		void reserve(size_type n) {
+			if (n > this->max_size())
+				throw std::length_error("mmap_vector: reserve");
+			if (n > this->_capacity)
+				this->remap(n);
+		}
+
+		// element access
+
+		reference operator[](size_type n) {
+			return this->_storage_start[n];
+		}
+
+		const_reference operator[](size_type n) const {
+			return this->_storage_start[n];
+		}
+
+		reference at(size_type n) {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return this->_storage_start[n];
+		}
+
+		const_reference at(size_type n) const {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return this->_storage_start[n];
+		}
+
+		reference front() {
+			return *this->_storage_start;
+		}
+
+		const_reference front() const {
+			return *this->_storage_start;
+		}
+
+		reference back() {
+			return this->_storage_start[this->_size - 1];
+		}
+
+		const_reference back() const {
+			return this->_storage_start[this->_size - 1];
+		}
+
+		pointer data() {
+			return this->_storage_start;
+		}
+
+		const_pointer data() const {
+			return this->_storage_start;
+		}
+
+		// modifiers
+
+		template<typename InputIterator>
+		void assign(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type& val) {
+			value_type tmp = val;
+			this->clear();
+			this->insert(this->end(), n, tmp);
+		}
+
+		void push_back(const value_type& val) {
+			if (this->_size == this->_capacity) {
+				value_type tmp = val;
+				this->remap(this->get_new_size(1, "mmap_vector: push_back"));
+				this->_storage_start[this->_size] = tmp;
+			} else {
+				this->checkWritable();
+				this->_storage_start[this->_size] = val;
+			}
+			this->_size++;
+		}
+
+		void pop_back() {
+			this->checkWritable();
+			this->_size--;
+		}
+
+		iterator insert(iterator position, const value_type& val) {
+			size_type position_idx = position - this->begin();
+			this->insert(position, 1, val);
+			return this->begin() + position_idx;
+		}
+
+		void insert(iterator position, size_type n, const value_type& val) {
+			if (n == 0) return;
+			value_type tmp = val;
+			size_type position_idx = position - this->begin();
+			this->openGap(position_idx, n, "mmap_vector: insert");
+			std::fill(this->_storage_start + position_idx, this->_storage_start + position_idx + n, tmp);
+		}
+
+		template<typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			typedef typename ft::iterator_traits<InputIterator>::iterator_category iterator_category;
+			this->range_insert(position - this->begin(), first, last, iterator_category());
+		}
+
+		iterator erase(iterator position) {
+			return this->erase(position, position + 1);
+		}
+
+		iterator erase(iterator first, iterator last) {
+			if (first == last) return first;
+			this->checkWritable();
+			std::memmove(static_cast<void*>(first.base()), static_cast<const void*>(last.base()), (this->end() - last) * sizeof(T));
+			this->_size -= last - first;
+			return first;
+		}
+
+		void swap(mmap_vector& x) {
+			if (this == &x) return;
+			std::swap(this->_fd, x._fd);
+			std::swap(this->_mode, x._mode);
+			std::swap(this->_storage_start, x._storage_start);
+			std::swap(this->_size, x._size);
+			std::swap(this->_capacity, x._capacity);
+		}
+
+		void clear() {
+			if (this->_size != 0)
+				this->checkWritable();
+			this->_size = 0;
+		}
+
+	private:
+		int _fd;
+		open_mode _mode;
+		pointer _storage_start;
+		size_type _size;
+		size_type _capacity;
+
+		mmap_vector(const mmap_vector&);
+		mmap_vector& operator=(const mmap_vector&);
+
+		static void fail(const char* s) {
+			throw std::runtime_error(std::string(s) + ": " + std::strerror(errno));
+		}
+
+		void checkWritable() const {
+			if (this->_fd < 0 || this->_mode == read_only)
+				throw std::logic_error("mmap_vector: not opened for writing");
+		}
+
+		/**
+		 * @brief Get new size to extend vector, as chosen by GrowthPolicy
+		 * @exception length_error if desired new size is bigger than max size
+		 */
+		size_type get_new_size(size_type size_to_extend, const char* s) {
+			if (this->max_size() - this->_size < size_to_extend)
+				throw std::length_error(s);
+			size_type needed = this->_size + size_to_extend;
+			size_type new_size = GrowthPolicy::next_capacity(this->_capacity, this->_size, size_to_extend, sizeof(value_type));
+			if (new_size < needed)
+				new_size = needed;
+			return new_size > this->max_size() ? this->max_size() : new_size;
+		}
+
+		/**
+		 * @brief Extend the file to new_capacity elements then the mapping,
+		 * the kernel moves the pages (mremap) instead of copying them
+		 * @exception Strong guarantee, the file is cut back if the mapping fails
+		 */
+		void remap(size_type new_capacity) {
+			this->checkWritable();
+			size_type old_bytes = this->_capacity * sizeof(T);
+			size_type new_bytes = new_capacity * sizeof(T);
+			if (ftruncate(this->_fd, static_cast<off_t>(new_bytes)) != 0)
+				mmap_vector::fail("mmap_vector: ftruncate");
+			void* q;
+			if (this->_storage_start == 0)
+				q = mmap(NULL, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+			else {
+			#ifdef MREMAP_MAYMOVE
+				q = mremap(this->_storage_start, old_bytes, new_bytes, MREMAP_MAYMOVE);
+			#else
+				q = mmap(NULL, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+				if (q != MAP_FAILED)
+					munmap(this->_storage_start, old_bytes);
+			#endif
+			}
+			if (q == MAP_FAILED) {
+				int ret = ftruncate(this->_fd, static_cast<off_t>(old_bytes));
+				(void)ret;
+				throw std::bad_alloc();
+			}
+			this->_storage_start = static_cast<pointer>(q);
+			this->_capacity = new_capacity;
+		}
+
+		/**
+		 * @brief Make room for n elements at position_idx, the gap is left
+		 * with the old values
+		 */
+		void openGap(size_type position_idx, size_type n, const char* s) {
+			if (this->_capacity - this->_size < n)
+				this->remap(this->get_new_size(n, s));
+			else
+				this->checkWritable();
+			pointer position = this->_storage_start + position_idx;
+			std::memmove(static_cast<void*>(position + n), static_cast<const void*>(position), (this->_size - position_idx) * sizeof(T));
+			this->_size += n;
+		}
+
+		template<typename InputIterator>
+		void range_insert(size_type position_idx, InputIterator first, InputIterator last, std::input_iterator_tag) {
+			size_type old_size = this->_size;
+			for (; first != last; ++first)
+				this->push_back(*first);
+			if (position_idx != old_size)
+				std::rotate(this->_storage_start + position_idx, this->_storage_start + old_size, this->_storage_start + this->_size);
+		}
+
+		template<typename ForwardIterator>
+		void range_insert(size_type position_idx, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+			size_type n = ft::distance(first, last);
+			if (n == 0) return;
+			this->openGap(position_idx, n, "mmap_vector: range insert");
+			std::copy(first, last, this->_storage_start + position_idx);
+		}
+	};
+
+	template<typename T, typename Growth>
+	bool operator==(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		return false;
+	}
+
+	template<typename T, typename Growth>
+	bool operator!=(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template<typename T, typename Growth>
+	bool operator<(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template<typename T, typename Growth>
+	bool operator<=(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename T, typename Growth>
+	bool operator>(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename T, typename Growth>
+	bool operator>=(const mmap_vector<T, Growth>& lhs, const mmap_vector<T, Growth>& rhs) {
+		return !(lhs < rhs);
+	}
+}
+
+namespace std {
+	template<typename T, typename Growth>
+	void swap(ft::mmap_vector<T, Growth>& x, ft::mmap_vector<T, Growth>& y) {
+		x.swap(y);
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "deque.hpp"
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+namespace ft {
+	template< typename T, typename Container = ft::deque<T> >
+	class queue {
+	public:
+		typedef Container							container_type;
+		typedef typename Container::value_type		value_type;
+		typedef typename Container::size_type		size_type;
+		// typedef typename Container::reference		reference; // C++11
+		// typedef typename Container::const_reference	const_reference; // C++11
+
+	public:
+		explicit queue(const container_type& ctnr = container_type()) : c(ctnr) {
+			#ifdef DEBUG
+				std::cout << "queue default constructor called" << std::endl;
+			#endif
+		}
+
+		queue(const queue& copy) : c(copy.c) {
+			#ifdef DEBUG
+				std::cout << "queue copy constructor called" << std::endl;
+			#endif
+		}
+
+		queue& operator=(const queue& other) {
+			#ifdef DEBUG
+				std::cout << "queue assignment operator called" << std::endl;
+			#endif
+			this->c = other.c;
+			return *this;
+		}
+
+		~queue() {
+			#ifdef DEBUG
+				std::cout << "queue deconstructor called" << std::endl;
+			#endif
+		}
+
+		bool empty() const {
+			return this->c.empty();
+		}
+
+		size_type size() const {
+			return this->c.size();
+		}
+
+		value_type& front() {
+			return this->c.front();
+		}
+
+		const value_type& front() const {
+			return this->c.front();
+		}
+
+		value_type& back() {
+			return this->c.back();
+		}
+
+		const value_type& back() const {
+			return this->c.back();
+		}
+
+		void push(const value_type& val) {
+			this->c.push_back(val);
+		}
+
+		void pop() {
+			this->c.pop_front();
+		}
+
+		template<class _T, class _Container>
+		friend bool operator==(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+		template<class _T, class _Container>
+		friend bool operator!=(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+		template<class _T, class _Container>
+		friend bool operator<(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+		template<class _T, class _Container>
+		friend bool operator<=(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+		template<class _T, class _Container>
+		friend bool operator>(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+		template<class _T, class _Container>
+		friend bool operator>=(const queue<_T, _Container>& lhs, const queue<_T, _Container>& rhs);
+
+	protected:
+		container_type c;
+	};
+
+	template<class T, class Container>
+	bool operator==(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c == rhs.c);
+	}
+
+	template<class T, class Container>
+	bool operator!=(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c != rhs.c);
+	}
+
+	template<class T, class Container>
+	bool operator<(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c < rhs.c);
+	}
+
+	template<class T, class Container>
+	bool operator<=(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c <= rhs.c);
+	}
+
+	template<class T, class Container>
+	bool operator>(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c > rhs.c);
+	}
+
+	template<class T, class Container>
+	bool operator>=(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+		return (lhs.c >= rhs.c);
+	}
+}
@@ -8,9 +8,13 @@
 #include <memory>
 
 namespace ft {
+	/**
+	 * @tparam Tree same requirements as the Tree of ft::map
+	 */
 	template<typename T,
 			typename Compare = ft::less<T>,
- 			typename Allocator = std::allocator<T> >
+ 			typename Allocator = std::allocator<T>,
+			template<typename, typename, typename> class Tree = ft::red_black_tree>
 	class set {
 	public:
 		typedef T													key_type;
@@ -26,7 +30,7 @@ namespace ft {
 		typedef std::size_t											size_type;
 
 	private:
-		typedef ft::red_black_tree<value_type, value_compare, allocator_type>	tree_type;
+		typedef Tree<value_type, value_compare, allocator_type>					tree_type;
 
 	public:
 		typedef typename tree_type::const_iterator						iterator;
@@ -49,7 +53,7 @@ namespace ft {
 		}
 
 		set(const set& x) :
-			_comp(key_compare()),
+			_comp(x._comp),
 			_tree_data(x._tree_data) {
 		}
 
@@ -115,10 +119,8 @@ namespace ft {
 			return this->_tree_data.insert(val);
 		}
 
-		// @note: ignore position hint for now (minimal performance lost)
 		iterator insert(iterator position, const value_type& val) {
-			(void)position;
-			return this->_tree_data.insert(val).first;
+			return this->_tree_data.insert(position, val).first;
 		}
 
 		template<typename InputIterator>
@@ -126,6 +128,25 @@ namespace ft {
 			this->_tree_data.insert(first, last);
 		}
 
+		/**
+		 * @brief Insert an unsorted range by sorting it on several threads
+		 * and rebuilding the tree in one pass. Worth it for large bulk loads.
+		 * @param workers number of sorting threads, 0 for one per cpu
+		 */
+		template<typename InputIterator>
+		void insert_parallel(InputIterator first, InputIterator last, size_type workers = 0) {
+			this->_tree_data.insert_parallel(first, last, workers);
+		}
+
+		/**
+		 * @brief Insert a range sorted by value, each search starting from
+		 * the previously inserted element.
+		 */
+		template<typename InputIterator>
+		void insert_sorted_batch(InputIterator first, InputIterator last) {
+			this->_tree_data.insert_sorted_batch(first, last);
+		}
+
 		void erase(iterator position) {
 			this->_tree_data.erase(position);
 		}
@@ -150,7 +171,7 @@ namespace ft {
 		// observers
 
 		key_compare key_comp() const {
-			return key_compare();
+			return this->_comp;
 		}
 
 		value_compare value_comp() const {
@@ -230,42 +251,62 @@ namespace ft {
 		tree_type _tree_data;
 	};
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator==(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	/**
+	 * @brief Erase every element for which pred is true in one in-order
+	 * walk. Each match is unlinked where the walk stands, erasing never
+	 * invalidates the other nodes so the walk just steps past it, no key
+	 * is searched again. pred is called once per element.
+	 * @return number of elements erased
+	 */
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree, typename Predicate>
+	typename set<T, Compare, Alloc, Tree>::size_type erase_if(set<T, Compare, Alloc, Tree>& c, Predicate pred) {
+		typename set<T, Compare, Alloc, Tree>::size_type old_size = c.size();
+		typename set<T, Compare, Alloc, Tree>::iterator it = c.begin();
+		while (it != c.end()) {
+			if (pred(*it))
+				c.erase(it++);
+			else
+				++it;
+		}
+		return old_size - c.size();
+	}
+
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator==(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		if (lhs.size() == rhs.size())
 			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		return false;
 	}
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator!=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator!=(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		return !(lhs == rhs);
 	}
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator<(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator<(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator<=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator<=(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		return !(rhs < lhs);
 	}
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator>(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator>(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		return rhs < lhs;
 	}
 
-	template<typename T, typename Compare, typename Alloc>
-	bool operator>=(const set<T, Compare, Alloc>& lhs, const set<T, Compare, Alloc>& rhs) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	bool operator>=(const set<T, Compare, Alloc, Tree>& lhs, const set<T, Compare, Alloc, Tree>& rhs) {
 		return !(lhs < rhs);
 	}
 }
 
 namespace std {
-	template<typename T, typename Compare, typename Alloc>
-	void swap(ft::set<T, Compare, Alloc>& x, ft::set<T, Compare, Alloc>& y) {
+	template<typename T, typename Compare, typename Alloc, template<typename, typename, typename> class Tree>
+	void swap(ft::set<T, Compare, Alloc, Tree>& x, ft::set<T, Compare, Alloc, Tree>& y) {
 		x.swap(y);
 	}
 }
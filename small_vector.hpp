@@ -0,0 +1,662 @@
+#pragma once
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+
+namespace ft {
+	/**
+	 * @brief Vector that keeps up to N elements inside the object itself and
+	 * only spills to memory from Allocator once it grows past N.
+	 * Same interface as ft::vector, short-lived small vectors never touch
+	 * the heap.
+	 * @note Swapping or growing an inline small_vector copies its elements,
+	 * iterators are invalidated like for ft::vector.
+	 */
+	template< typename T, std::size_t N, typename Allocator = std::allocator<T> >
+	class small_vector {
+	public:
+		typedef T													value_type;
+		typedef Allocator											allocator_type;
+		typedef typename Allocator::reference						reference;
+		typedef typename Allocator::const_reference					const_reference;
+		typedef typename Allocator::pointer							pointer;
+		typedef typename Allocator::const_pointer					const_pointer;
+		typedef ft::pointer_iterator<pointer, small_vector>			iterator;
+		typedef ft::pointer_iterator<const_pointer, small_vector>	const_iterator;
+		typedef ft::rai_reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::rai_reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t										difference_type;
+		typedef std::size_t											size_type;
+
+		static const size_type inline_capacity = N;
+
+	public:
+		// construct/copy/destroy
+
+		/**
+		 * @brief Creates a small_vector with no elements, using the inline
+		 * storage.
+		 * @param alloc An allocator object, only used past N elements.
+		 */
+		explicit small_vector(const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_storage_start(this->inline_storage()),
+			_size(0),
+			_capacity(N) {
+			(void)sizeof(ft::compile_time_check<(N > 0)>);
+		}
+
+		/**
+		 * @brief Creates a small_vector with n copies of val.
+		 */
+		explicit small_vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_storage_start(this->inline_storage()),
+			_size(0),
+			_capacity(N) {
+			(void)sizeof(ft::compile_time_check<(N > 0)>);
+			try {
+				this->assign(n, val);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		/**
+		 * @brief Builds a small_vector from a range [first, last).
+		 */
+		template<typename InputIterator>
+		small_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::iterator_traits<InputIterator>::iterator_category* = 0) :
+			_allocator(alloc),
+			_storage_start(this->inline_storage()),
+			_size(0),
+			_capacity(N) {
+			(void)sizeof(ft::compile_time_check<(N > 0)>);
+			try {
+				this->assign(first, last);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		/**
+		 * @brief small_vector copy constructor
+		 * The copy is inline whenever x's elements fit in N.
+		 */
+		small_vector(const small_vector& x) :
+			_allocator(x.get_allocator()),
+			_storage_start(this->inline_storage()),
+			_size(0),
+			_capacity(N) {
+			try {
+				this->assign(x.begin(), x.end());
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		~small_vector() {
+			this->release();
+		}
+
+		small_vector& operator=(const small_vector& x) {
+			if (&x == this) return *this;
+			this->assign(x.begin(), x.end());
+			return *this;
+		}
+
+		// iterators
+
+		iterator begin() {
+			return iterator(this->_storage_start);
+		}
+
+		const_iterator begin() const {
+			return const_iterator(this->_storage_start);
+		}
+
+		iterator end() {
+			return iterator(this->_storage_start + this->_size);
+		}
+
+		const_iterator end() const {
+			return const_iterator(this->_storage_start + this->_size);
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(this->begin());
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			return this->get_allocator().max_size();
+		}
+
+		void resize(size_type n, value_type val = value_type()) {
+			if (n < this->_size)
+				this->destroy_from_end(this->_size - n);
+			else if (n > this->_size)
+				this->_insert(this->end(), n - this->_size, val);
+		}
+
+		size_type capacity() const {
+			return this->_capacity;
+		}
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		/**
+		 * @brief Returns true while the elements live in the inline storage.
+		 */
+		bool is_inline() const {
+			return this->_storage_start == this->inline_storage();
+		}
+
+		/**
+		 * @brief Reserve heap storage for n elements, no-op while n <= capacity()
+		 * @throw std::length_error if n exceeds max_size().
+		 */
+		void reserve(size_type n) {
+			if (n > this->max_size())
+				throw std::length_error("small_vector: reserve");
+			if (n > this->_capacity)
+				this->increase_capacity(n);
+		}
+
+		// element access
+
+		reference operator[](size_type n) {
+			return *(this->_storage_start + n);
+		}
+
+		const_reference operator[](size_type n) const {
+			return *(this->_storage_start + n);
+		}
+
+		reference at(size_type n) {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return *(this->_storage_start + n);
+		}
+
+		const_reference at(size_type n) const {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return *(this->_storage_start + n);
+		}
+
+		reference front() {
+			return *this->_storage_start;
+		}
+
+		const_reference front() const {
+			return *this->_storage_start;
+		}
+
+		reference back() {
+			return *(this->_storage_start + this->_size - 1);
+		}
+
+		const_reference back() const {
+			return *(this->_storage_start + this->_size - 1);
+		}
+
+		pointer data() {
+			return this->_storage_start;
+		}
+
+		const_pointer data() const {
+			return this->_storage_start;
+		}
+
+		// modifiers
+
+		template<typename InputIterator>
+		void assign(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			typedef typename ft::iterator_traits<InputIterator>::iterator_category iterator_category;
+			this->_assign(ft::unwrap_iterator(first), ft::unwrap_iterator(last), iterator_category());
+		}
+
+		void assign(size_type n, const value_type& val) {
+			if (n > this->_capacity) {
+				if (n > this->max_size())
+					throw std::length_error("small_vector: assign");
+				pointer new_storage_start = this->_allocator.allocate(n);
+				try {
+					std::uninitialized_fill_n(new_storage_start, n, val);
+				} catch (...) {
+					this->_allocator.deallocate(new_storage_start, n);
+					throw;
+				}
+				this->release();
+				this->_storage_start = new_storage_start;
+				this->_size = n;
+				this->_capacity = n;
+			} else if (n > this->_size) {
+				std::fill(this->_storage_start, this->_storage_start + this->_size, val);
+				std::uninitialized_fill_n(this->_storage_start + this->_size, n - this->_size, val);
+				this->_size = n;
+			} else {
+				std::fill_n(this->_storage_start, n, val);
+				this->destroy_from_end(this->_size - n);
+			}
+		}
+
+		void push_back(const value_type& val) {
+			if (this->_size == this->_capacity) {
+				value_type copy(val);
+				this->increase_capacity(this->get_new_size(1, "small_vector: push_back"));
+				this->_allocator.construct(this->_storage_start + this->_size, copy);
+			} else {
+				this->_allocator.construct(this->_storage_start + this->_size, val);
+			}
+			this->_size++;
+		}
+
+		void pop_back() {
+			this->_allocator.destroy(this->_storage_start + this->_size - 1);
+			this->_size--;
+		}
+
+		iterator insert(iterator position, const value_type& val) {
+			size_type position_idx = position - this->begin();
+			this->_insert(position, 1, val);
+			return iterator(this->_storage_start + position_idx);
+		}
+
+		void insert(iterator position, size_type n, const value_type& val) {
+			this->_insert(position, n, val);
+		}
+
+		template<typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			typedef typename ft::iterator_traits<InputIterator>::iterator_category iterator_category;
+			this->range_insert(position, ft::unwrap_iterator(first), ft::unwrap_iterator(last), iterator_category());
+		}
+
+		iterator erase(iterator position) {
+			return this->erase(position, position + 1);
+		}
+
+		iterator erase(iterator first, iterator last) {
+			if (first == last) return first;
+			std::copy(last.base(), this->_storage_start + this->_size, first.base());
+			this->destroy_from_end(last - first);
+			return first;
+		}
+
+		/**
+		 * @brief Swap contents with x.
+		 * O(1) when both are on the heap, otherwise the inline elements are
+		 * copied into the other object.
+		 * @exception Basic guarantee when an inline element copy throws
+		 */
+		void swap(small_vector& x) {
+			if (this == &x) return;
+			if (!this->is_inline() && !x.is_inline()) {
+				std::swap(this->_storage_start, x._storage_start);
+				std::swap(this->_size, x._size);
+				std::swap(this->_capacity, x._capacity);
+			} else if (this->is_inline() && x.is_inline()) {
+				small_vector& longer = this->_size < x._size ? x : *this;
+				small_vector& shorter = this->_size < x._size ? *this : x;
+				size_type common = shorter._size;
+				std::swap_ranges(longer._storage_start, longer._storage_start + common, shorter._storage_start);
+				std::uninitialized_copy(longer._storage_start + common, longer._storage_start + longer._size, shorter._storage_start + common);
+				shorter._size = longer._size;
+				longer.destroy_from_end(longer._size - common);
+			} else {
+				small_vector& on_heap = this->is_inline() ? x : *this;
+				small_vector& on_stack = this->is_inline() ? *this : x;
+				std::uninitialized_copy(on_stack._storage_start, on_stack._storage_start + on_stack._size, on_heap.inline_storage());
+				pointer heap_start = on_heap._storage_start;
+				size_type heap_size = on_heap._size;
+				size_type heap_capacity = on_heap._capacity;
+				on_heap._storage_start = on_heap.inline_storage();
+				on_heap._size = on_stack._size;
+				on_heap._capacity = N;
+				on_stack.destroy_from_end(on_stack._size);
+				on_stack._storage_start = heap_start;
+				on_stack._size = heap_size;
+				on_stack._capacity = heap_capacity;
+			}
+		}
+
+		void clear() {
+			this->destroy_from_end(this->_size);
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+	private:
+		// Inline buffer, the union aligns it for any fundamental type
+		union inline_buffer {
+			char bytes[sizeof(T) * N];
+			long double align_long_double;
+			double align_double;
+			long align_long;
+			void* align_pointer;
+		};
+
+		allocator_type _allocator;
+		pointer _storage_start;
+		size_type _size;
+		size_type _capacity;
+		inline_buffer _inline;
+
+		pointer inline_storage() {
+			return reinterpret_cast<pointer>(this->_inline.bytes);
+		}
+
+		const_pointer inline_storage() const {
+			return reinterpret_cast<const_pointer>(this->_inline.bytes);
+		}
+
+		/**
+		 * @brief Destroy every element and give the heap block back, if any
+		 */
+		void release() {
+			this->destroy_from_end(this->_size);
+			if (!this->is_inline())
+				this->_allocator.deallocate(this->_storage_start, this->_capacity);
+			this->_storage_start = this->inline_storage();
+			this->_capacity = N;
+		}
+
+		template<typename InputIterator>
+		void _assign(InputIterator first, InputIterator last, std::input_iterator_tag) {
+			pointer _begin = this->_storage_start;
+			pointer _end = this->_storage_start + this->_size;
+			for (; first != last && _begin != _end ; ++first, ++_begin)
+				*_begin = *first;
+			if (first == last)
+				this->destroy_from_end(_end - _begin);
+			else
+				this->range_insert(this->end(), first, last, std::input_iterator_tag());
+		}
+
+		/**
+		 * @brief Range assign with forward iterator base
+		 * @note Past capacity the range is built into new heap storage first
+		 * (Strong guarantee)
+		 */
+		template<typename InputIterator>
+		void _assign(InputIterator first, InputIterator last, std::forward_iterator_tag) {
+			size_type len = ft::distance(first, last);
+			if (len > this->_capacity) {
+				if (len > this->max_size())
+					throw std::length_error("small_vector: assign");
+				pointer new_storage_start = this->_allocator.allocate(len);
+				try {
+					std::uninitialized_copy(first, last, new_storage_start);
+				} catch (...) {
+					this->_allocator.deallocate(new_storage_start, len);
+					throw;
+				}
+				this->release();
+				this->_storage_start = new_storage_start;
+				this->_size = len;
+				this->_capacity = len;
+			} else if (len > this->_size) {
+				InputIterator mid = first;
+				std::advance(mid, this->_size);
+				std::copy(first, mid, this->_storage_start);
+				std::uninitialized_copy(mid, last, this->_storage_start + this->_size);
+				this->_size = len;
+			} else {
+				std::copy(first, last, this->_storage_start);
+				this->destroy_from_end(this->_size - len);
+			}
+		}
+
+		/**
+		 * @brief Move the elements to a heap block of new_capacity
+		 * @note This doesn't check if new_capacity is within max_size
+		 * @exception Strong guarantee
+		 */
+		void increase_capacity(size_type new_capacity) {
+			pointer new_storage_start = this->_allocator.allocate(new_capacity);
+			try {
+				std::uninitialized_copy(this->_storage_start, this->_storage_start + this->_size, new_storage_start);
+			} catch (...) {
+				this->_allocator.deallocate(new_storage_start, new_capacity);
+				throw;
+			}
+			size_type new_size = this->_size;
+			this->release();
+			this->_storage_start = new_storage_start;
+			this->_size = new_size;
+			this->_capacity = new_capacity;
+		}
+
+		/**
+		 * @brief Get new capacity to extend by size_to_extend, doubling like
+		 * ft::vector's default growth
+		 * @exception length_error if desired new size is bigger than max size
+		 */
+		size_type get_new_size(size_type size_to_extend, const char *s) const {
+			if (this->max_size() - this->_size < size_to_extend)
+				throw std::length_error(s);
+			size_type new_size = this->_capacity + std::max(this->_capacity, size_to_extend);
+			if (new_size < this->_size + size_to_extend)
+				new_size = this->_size + size_to_extend;
+			return new_size > this->max_size() ? this->max_size() : new_size;
+		}
+
+		/**
+		 * @brief Insert [first, last) of n elements at position_idx into the
+		 * spare capacity, the tail is shifted back like libstdc++ does
+		 * @note Needs capacity for n more elements (Basic guarantee)
+		 */
+		template<typename ForwardIterator>
+		void insert_in_place(size_type position_idx, ForwardIterator first, ForwardIterator last, size_type n) {
+			pointer position = this->_storage_start + position_idx;
+			pointer old_end = this->_storage_start + this->_size;
+			size_type elems_after = old_end - position;
+			if (elems_after > n) {
+				std::uninitialized_copy(old_end - n, old_end, old_end);
+				this->_size += n;
+				std::copy_backward(position, old_end - n, old_end);
+				std::copy(first, last, position);
+			} else {
+				ForwardIterator mid = first;
+				std::advance(mid, elems_after);
+				std::uninitialized_copy(mid, last, old_end);
+				this->_size += n - elems_after;
+				std::uninitialized_copy(position, old_end, position + n);
+				this->_size += elems_after;
+				std::copy(first, mid, position);
+			}
+		}
+
+		/**
+		 * @brief Build position's neighbourhood and [first, last) into a new
+		 * heap block of the grown capacity (Strong guarantee)
+		 */
+		template<typename ForwardIterator>
+		void insert_realloc(size_type position_idx, ForwardIterator first, ForwardIterator last, size_type n) {
+			size_type new_capacity = this->get_new_size(n, "small_vector: insert");
+			pointer new_storage_start = this->_allocator.allocate(new_capacity);
+			pointer new_storage_end = new_storage_start;
+			pointer position = this->_storage_start + position_idx;
+			try {
+				new_storage_end = std::uninitialized_copy(this->_storage_start, position, new_storage_end);
+				new_storage_end = std::uninitialized_copy(first, last, new_storage_end);
+				new_storage_end = std::uninitialized_copy(position, this->_storage_start + this->_size, new_storage_end);
+			} catch (...) {
+				for (pointer p = new_storage_start; p != new_storage_end; ++p)
+					this->_allocator.destroy(p);
+				this->_allocator.deallocate(new_storage_start, new_capacity);
+				throw;
+			}
+			this->release();
+			this->_storage_start = new_storage_start;
+			this->_size = new_storage_end - new_storage_start;
+			this->_capacity = new_capacity;
+		}
+
+		/**
+		 * @brief Range insert with input iterator
+		 * @note Appended one by one then rotated into place like
+		 * ft::vector does, no temporary small_vector
+		 * @note If an append or the rotation buffer fails the appended
+		 * elements are destroyed (Strong guarantee)
+		 */
+		template<typename InputIterator>
+		void range_insert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag) {
+			size_type position_idx = position - this->begin();
+			size_type old_size = this->_size;
+			try {
+				for (; first != last; ++first)
+					this->push_back(*first);
+				if (position_idx != old_size)
+					ft::_rotate_appended(this->_storage_start + position_idx, this->_storage_start + old_size, this->_storage_start + this->_size, this->_allocator);
+			} catch (...) {
+				this->destroy_from_end(this->_size - old_size);
+				throw;
+			}
+		}
+
+		template<typename InputIterator>
+		void range_insert(iterator position, InputIterator first, InputIterator last, std::forward_iterator_tag) {
+			if (first == last) return;
+			size_type n = ft::distance(first, last);
+			size_type position_idx = position - this->begin();
+			if (this->_capacity - this->_size >= n)
+				this->insert_in_place(position_idx, first, last, n);
+			else
+				this->insert_realloc(position_idx, first, last, n);
+		}
+
+		/**
+		 * @brief Fill insert, same shape as range_insert
+		 * @note val is copied first since it may be an element of this
+		 */
+		void _insert(iterator position, size_type n, const value_type& val) {
+			if (n == 0) return;
+			value_type copy(val);
+			size_type position_idx = position - this->begin();
+			if (this->_capacity - this->_size >= n) {
+				// Basic guarantee
+				pointer _position = this->_storage_start + position_idx;
+				pointer old_end = this->_storage_start + this->_size;
+				size_type elems_after = old_end - _position;
+				if (elems_after > n) {
+					std::uninitialized_copy(old_end - n, old_end, old_end);
+					this->_size += n;
+					std::copy_backward(_position, old_end - n, old_end);
+					std::fill_n(_position, n, copy);
+				} else {
+					std::uninitialized_fill_n(old_end, n - elems_after, copy);
+					this->_size += n - elems_after;
+					std::uninitialized_copy(_position, old_end, _position + n);
+					this->_size += elems_after;
+					std::fill(_position, old_end, copy);
+				}
+			} else {
+				// Strong guarantee
+				size_type new_capacity = this->get_new_size(n, "small_vector: _insert");
+				pointer new_storage_start = this->_allocator.allocate(new_capacity);
+				pointer new_storage_end = new_storage_start;
+				pointer _position = this->_storage_start + position_idx;
+				try {
+					new_storage_end = std::uninitialized_copy(this->_storage_start, _position, new_storage_end);
+					std::uninitialized_fill_n(new_storage_end, n, copy);
+					new_storage_end += n;
+					new_storage_end = std::uninitialized_copy(_position, this->_storage_start + this->_size, new_storage_end);
+				} catch (...) {
+					for (pointer p = new_storage_start; p != new_storage_end; ++p)
+						this->_allocator.destroy(p);
+					this->_allocator.deallocate(new_storage_start, new_capacity);
+					throw;
+				}
+				this->release();
+				this->_storage_start = new_storage_start;
+				this->_size = new_storage_end - new_storage_start;
+				this->_capacity = new_capacity;
+			}
+		}
+
+		void destroy_from_end(size_type n) {
+			for (; n > 0; --n) {
+				--this->_size;
+				this->_allocator.destroy(this->_storage_start + this->_size);
+			}
+		}
+	};
+
+	template<typename T, std::size_t N, typename Allocator>
+	const typename small_vector<T, N, Allocator>::size_type small_vector<T, N, Allocator>::inline_capacity;
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		return false;
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+}
+
+namespace std {
+	template<typename T, std::size_t N, typename Alloc>
+	void swap(ft::small_vector<T, N, Alloc>& x, ft::small_vector<T, N, Alloc>& y) {
+		x.swap(y);
+	}
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+namespace ft {
+	// subspan() count meaning "up to the end"
+	const std::size_t dynamic_extent = static_cast<std::size_t>(-1);
+
+	// Detects contiguous containers a span can view: c.data() and c.size()
+	// both compile. T may be const, then the const members are checked.
+	template<typename T>
+	struct _has_data_and_size {
+		private:
+			template<typename _T>
+			static char _test(char (*)[sizeof(static_cast<_T*>(0)->data()) + sizeof(static_cast<_T*>(0)->size())]);
+			template<typename _T>
+			static int _test(...);
+
+		public:
+			static const bool value = sizeof(_test<T>(0)) == 1;
+	};
+
+	template<typename T>
+	const bool _has_data_and_size<T>::value;
+
+	/**
+	 * @brief Non-owning view of n contiguous elements (pointer + length),
+	 * C++98 version of std::span with a runtime extent.
+	 * Cheap to copy, pass it by value instead of copying a subrange into a
+	 * new vector. span<const T> is the read-only view.
+	 * @note Doesn't own anything, the viewed storage must outlive it and
+	 * any reallocation of the container invalidates it.
+	 */
+	template<typename T>
+	class span {
+	public:
+		typedef T												element_type;
+		typedef typename ft::remove_const<T>::type				value_type;
+		typedef T*												pointer;
+		typedef const T*										const_pointer;
+		typedef T&												reference;
+		typedef const T&										const_reference;
+		typedef ft::pointer_iterator<pointer, span>				iterator;
+		typedef ft::rai_reverse_iterator<iterator>				reverse_iterator;
+		typedef std::ptrdiff_t									difference_type;
+		typedef std::size_t										size_type;
+
+	public:
+		span() : _data(0), _size(0) { }
+
+		span(pointer data, size_type n) : _data(data), _size(n) { }
+
+		template<typename U>
+		span(U* first, U* last) : _data(first), _size(last - first) { }
+
+		template<typename U, std::size_t N>
+		span(U (&array)[N]) : _data(array), _size(N) { }
+
+		/**
+		 * @brief View the elements of any contiguous container with data()
+		 * and size() (ft::vector, ft::small_vector, ft::mmap_vector, another
+		 * span...). A span<const T> can view a const container.
+		 * @note A temporary container binds to the const overload, the
+		 * span must not outlive that full expression.
+		 * @note Only takes part in overload resolution for types with data()
+		 * and size() (see _has_data_and_size).
+		 */
+		template<typename Container>
+		span(Container& c, typename ft::enable_if<ft::_has_data_and_size<Container>::value, int>::type* = 0) :
+			_data(c.data()),
+			_size(c.size()) { }
+
+		template<typename Container>
+		span(const Container& c, typename ft::enable_if<ft::_has_data_and_size<const Container>::value, int>::type* = 0) :
+			_data(c.data()),
+			_size(c.size()) { }
+
+		span(const span& copy) : _data(copy._data), _size(copy._size) { }
+
+		span& operator=(const span& rhs) {
+			this->_data = rhs._data;
+			this->_size = rhs._size;
+			return *this;
+		}
+
+		// iterators
+
+		iterator begin() const {
+			return iterator(this->_data);
+		}
+
+		iterator end() const {
+			return iterator(this->_data + this->_size);
+		}
+
+		reverse_iterator rbegin() const {
+			return reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend() const {
+			return reverse_iterator(this->begin());
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type size_bytes() const {
+			return this->_size * sizeof(element_type);
+		}
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		// element access
+
+		reference operator[](size_type n) const {
+			return this->_data[n];
+		}
+
+		reference at(size_type n) const {
+			if (n >= this->_size)
+				throw std::out_of_range("out of range");
+			return this->_data[n];
+		}
+
+		reference front() const {
+			return *this->_data;
+		}
+
+		reference back() const {
+			return this->_data[this->_size - 1];
+		}
+
+		pointer data() const {
+			return this->_data;
+		}
+
+		// subviews, their bounds are only checked by assert (off with NDEBUG)
+
+		/**
+		 * @brief View of the first n elements
+		 */
+		span first(size_type n) const {
+			assert(n <= this->_size);
+			return span(this->_data, n);
+		}
+
+		/**
+		 * @brief View of the last n elements
+		 */
+		span last(size_type n) const {
+			assert(n <= this->_size);
+			return span(this->_data + (this->_size - n), n);
+		}
+
+		/**
+		 * @brief View of count elements from offset, or of everything from
+		 * offset with dynamic_extent
+		 */
+		span subspan(size_type offset, size_type count = ft::dynamic_extent) const {
+			assert(offset <= this->_size);
+			assert(count == ft::dynamic_extent || count <= this->_size - offset);
+			return span(this->_data + offset, count == ft::dynamic_extent ? this->_size - offset : count);
+		}
+
+	private:
+		pointer _data;
+		size_type _size;
+	};
+}
@@ -1,12 +1,13 @@
 #pragma once
 
 #include "vector.hpp"
+#include "deque.hpp"
 #ifdef DEBUG
 #include <iostream>
 #endif
 
 namespace ft {
-	template< typename T, typename Container = ft::vector<T> >
+	template< typename T, typename Container = ft::deque<T> >
 	class stack {
 	public:
 		typedef Container							container_type;
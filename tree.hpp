@@ -3,8 +3,14 @@
 #include "utility.hpp"
 #include "functional.hpp"
 #include "iterator.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
 
 #include <memory>
+#include <new>
+#include <algorithm>
+#include <stdexcept>
+#include <stdint.h>
 
 #ifdef _TREE_DEBUG
 #include <iostream>
@@ -178,6 +184,337 @@ namespace ft {
 		}
 	};
 
+	template<typename T>
+	struct splay_tree_node : public binary_tree_node<T, splay_tree_node<T> > {
+		typedef typename binary_tree_node<T, splay_tree_node>::value_type		value_type;
+		typedef typename binary_tree_node<T, splay_tree_node>::pointer			pointer;
+		typedef typename binary_tree_node<T, splay_tree_node>::node_pointer		node_pointer;
+
+		splay_tree_node() : binary_tree_node<T, splay_tree_node>() {}
+
+		splay_tree_node(value_type _value, node_pointer _parent) : binary_tree_node<T, splay_tree_node>(_value, _parent) {}
+
+		splay_tree_node(const splay_tree_node& other) : binary_tree_node<T, splay_tree_node>(other) {}
+
+		~splay_tree_node() {}
+	};
+
+	/**
+	 * @brief Red black tree node linked by 32-bit indices into an arena
+	 * instead of pointers. The color lives in the top bit of the parent
+	 * index, so a tree holds at most npos - 1 nodes.
+	 * @note Only the links are stored here, the value of node i lives in
+	 * the value chunks of the arena (see compact_rb_tree_arena). A released
+	 * slot has left == free_mark and no value.
+	 */
+	template<typename T>
+	struct compact_rb_tree_node {
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef uint32_t		index_type;
+
+		static const index_type npos = 0x7FFFFFFF;
+		static const index_type free_mark = 0x7FFFFFFE;
+		static const index_type color_mask = 0x80000000;
+
+		index_type parent_color;
+		index_type left;
+		index_type right;
+
+		explicit compact_rb_tree_node(index_type _parent) : parent_color(_parent), left(npos), right(npos) {
+			this->setColor(_parent == npos ? BLACK : RED);
+		}
+
+		bool isReleased() const {
+			return this->left == free_mark;
+		}
+
+		/**
+		 * @brief Reset the links of a released slot for a new value
+		 */
+		void reuse(index_type _parent) {
+			this->parent_color = _parent;
+			this->left = npos;
+			this->right = npos;
+			this->setColor(_parent == npos ? BLACK : RED);
+		}
+
+		index_type getParent() const {
+			return this->parent_color & ~color_mask;
+		}
+
+		void setParent(index_type parent) {
+			this->parent_color = (this->parent_color & color_mask) | parent;
+		}
+
+		rb_tree_color getColor() const {
+			return (this->parent_color & color_mask) ? BLACK : RED;
+		}
+
+		void setColor(rb_tree_color color) {
+			if (color == BLACK)
+				this->parent_color |= color_mask;
+			else
+				this->parent_color &= ~color_mask;
+		}
+
+		template<typename Arena>
+		static index_type getMinimum(const Arena& arena, index_type node) {
+			if (node == npos)
+				return npos;
+			while (arena[node].left != npos)
+				node = arena[node].left;
+			return node;
+		}
+
+		template<typename Arena>
+		static index_type getMaximum(const Arena& arena, index_type node) {
+			if (node == npos)
+				return npos;
+			while (arena[node].right != npos)
+				node = arena[node].right;
+			return node;
+		}
+
+		template<typename Arena>
+		static index_type getSuccessor(const Arena& arena, index_type node) {
+			if (arena[node].right != npos)
+				return compact_rb_tree_node::getMinimum(arena, arena[node].right);
+			index_type parent = arena[node].getParent();
+			while (parent != npos && node == arena[parent].right) {
+				node = parent;
+				parent = arena[parent].getParent();
+			}
+			return parent;
+		}
+
+		template<typename Arena>
+		static index_type getPredecessor(const Arena& arena, index_type node) {
+			if (arena[node].left != npos)
+				return compact_rb_tree_node::getMaximum(arena, arena[node].left);
+			index_type parent = arena[node].getParent();
+			while (parent != npos && node == arena[parent].left) {
+				node = parent;
+				parent = arena[parent].getParent();
+			}
+			return parent;
+		}
+	};
+
+	template<typename T>
+	const typename compact_rb_tree_node<T>::index_type compact_rb_tree_node<T>::npos;
+
+	template<typename T>
+	const typename compact_rb_tree_node<T>::index_type compact_rb_tree_node<T>::free_mark;
+
+	template<typename T>
+	const typename compact_rb_tree_node<T>::index_type compact_rb_tree_node<T>::color_mask;
+
+	/**
+	 * @brief Storage of a compact_red_black_tree: the links of every slot
+	 * in one flat ft::vector, the values in fixed chunks of chunk_size
+	 * slots. Growing only reallocates the links and the chunk table, a
+	 * value never moves, so references and pointers to elements stay valid
+	 * like in the pointer based trees.
+	 * @note Slot i is live when its links aren't released, only live slots
+	 * hold a constructed value.
+	 */
+	template<typename T, typename Allocator>
+	class compact_rb_tree_arena {
+	public:
+		typedef ft::compact_rb_tree_node<T>									node_type;
+		typedef typename node_type::index_type								index_type;
+		typedef T															value_type;
+		typedef Allocator													allocator_type;
+		typedef typename Allocator::pointer									pointer;
+		typedef std::size_t													size_type;
+		typedef typename allocator_type::template rebind<node_type>::other	node_allocator_type;
+		typedef typename allocator_type::template rebind<pointer>::other	chunk_table_allocator_type;
+
+		static const size_type chunk_size = 64;
+
+	public:
+		explicit compact_rb_tree_arena(const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_links(node_allocator_type(alloc)),
+			_chunks(chunk_table_allocator_type(alloc)) {}
+
+		~compact_rb_tree_arena() {
+			this->clear();
+			for (size_type i = 0; i < this->_chunks.size(); ++i)
+				this->_allocator.deallocate(this->_chunks[i], chunk_size);
+		}
+
+		node_type& operator[](index_type i) {
+			return this->_links[i];
+		}
+
+		const node_type& operator[](index_type i) const {
+			return this->_links[i];
+		}
+
+		value_type& value(index_type i) {
+			return this->_chunks[i / chunk_size][i % chunk_size];
+		}
+
+		const value_type& value(index_type i) const {
+			return this->_chunks[i / chunk_size][i % chunk_size];
+		}
+
+		size_type size() const {
+			return this->_links.size();
+		}
+
+		size_type max_size() const {
+			return this->_links.max_size();
+		}
+
+		void reserve(size_type n) {
+			this->_links.reserve(n);
+			this->_chunks.reserve((n + chunk_size - 1) / chunk_size);
+		}
+
+		/**
+		 * @brief Append a live slot holding a copy of val
+		 * @exception Strong guarantee, a new empty chunk may be kept
+		 */
+		void push_back(const value_type& val, index_type parent) {
+			index_type i = static_cast<index_type>(this->_links.size());
+			this->growChunks(i);
+			this->_allocator.construct(&this->value(i), val);
+			try {
+				this->_links.push_back(node_type(parent));
+			} catch (...) {
+				this->_allocator.destroy(&this->value(i));
+				throw;
+			}
+		}
+
+		/**
+		 * @brief Construct val in the released slot i
+		 * @exception Strong guarantee, the slot stays released
+		 */
+		void reuse(index_type i, const value_type& val, index_type parent) {
+			this->_allocator.construct(&this->value(i), val);
+			this->_links[i].reuse(parent);
+		}
+
+		/**
+		 * @brief Destroy the value of slot i, the slot keeps only its links
+		 */
+		void release(index_type i) {
+			this->_allocator.destroy(&this->value(i));
+			this->_links[i].left = node_type::free_mark;
+		}
+
+		/**
+		 * @brief Destroy every value and drop the slots, the chunks are kept
+		 * for the next inserts
+		 */
+		void clear() {
+			for (size_type i = 0; i < this->_links.size(); ++i)
+				if (!this->_links[i].isReleased())
+					this->_allocator.destroy(&this->value(static_cast<index_type>(i)));
+			this->_links.clear();
+		}
+
+		/**
+		 * @brief Copy other slot by slot, released slots stay released
+		 * @note On exception the slots copied so far are kept, clear()
+		 * destroys them
+		 */
+		void copy(const compact_rb_tree_arena& other) {
+			this->clear();
+			this->reserve(other.size());
+			for (index_type i = 0; i < other.size(); ++i) {
+				if (other[i].isReleased()) {
+					this->_links.push_back(other[i]);
+				} else {
+					this->push_back(other.value(i), node_type::npos);
+					this->_links[i] = other[i];
+				}
+			}
+		}
+
+		node_allocator_type get_allocator() const {
+			return this->_links.get_allocator();
+		}
+
+	private:
+		allocator_type _allocator;
+		ft::vector<node_type, node_allocator_type> _links;
+		ft::vector<pointer, chunk_table_allocator_type> _chunks;
+
+		compact_rb_tree_arena(const compact_rb_tree_arena&);
+		compact_rb_tree_arena& operator=(const compact_rb_tree_arena&);
+
+		/**
+		 * @brief Allocate chunks until slot i has one
+		 */
+		void growChunks(index_type i) {
+			while (i / chunk_size >= this->_chunks.size()) {
+				pointer chunk = this->_allocator.allocate(chunk_size);
+				try {
+					this->_chunks.push_back(chunk);
+				} catch (...) {
+					this->_allocator.deallocate(chunk, chunk_size);
+					throw;
+				}
+			}
+		}
+	};
+
+	template<typename T, typename Allocator>
+	const typename compact_rb_tree_arena<T, Allocator>::size_type compact_rb_tree_arena<T, Allocator>::chunk_size;
+
+	template<typename T, typename Compare>
+	struct value_pointer_compare {
+		const Compare* comp;
+
+		explicit value_pointer_compare(const Compare* c) : comp(c) {}
+
+		bool operator()(const T* x, const T* y) const {
+			return (*this->comp)(*x, *y);
+		}
+	};
+
+	template<typename T, typename Compare>
+	struct value_pointer_equivalent {
+		const Compare* comp;
+
+		explicit value_pointer_equivalent(const Compare* c) : comp(c) {}
+
+		bool operator()(const T* x, const T* y) const {
+			return !(*this->comp)(*x, *y) && !(*this->comp)(*y, *x);
+		}
+	};
+
+	/**
+	 * @brief First half of every tree's insert_parallel: copy [first, last)
+	 * into buffer, point values at the current elements of tree followed by
+	 * buffer, stable sort them in parallel and drop equivalent ones (first
+	 * one wins, so existing keys are kept like insert does).
+	 * @return number of sorted unique pointers at the front of values
+	 */
+	template<typename Tree, typename InputIterator>
+	std::size_t gather_sorted_unique(const Tree& tree, const typename Tree::compare_type& comp, InputIterator first, InputIterator last, std::size_t workers,
+									ft::vector<typename Tree::value_type>& buffer, ft::vector<const typename Tree::value_type*>& values) {
+		typedef typename Tree::value_type value_type;
+		for (; first != last; ++first)
+			buffer.push_back(*first);
+		if (buffer.empty())
+			return 0;
+		values.reserve(tree.size() + buffer.size());
+		for (typename Tree::const_iterator it = tree.begin(), ite = tree.end(); it != ite; ++it)
+			values.push_back(&*it);
+		for (std::size_t i = 0; i < buffer.size(); ++i)
+			values.push_back(&buffer[i]);
+
+		const value_type** sorted = values.data();
+		ft::parallel_stable_sort(sorted, sorted + values.size(), value_pointer_compare<value_type, typename Tree::compare_type>(&comp), workers);
+		return std::unique(sorted, sorted + values.size(), value_pointer_equivalent<value_type, typename Tree::compare_type>(&comp)) - sorted;
+	}
+
 	template<typename T,
 			typename Compare = ft::less<T>,
 			typename Allocator = std::allocator<T> >
@@ -210,7 +547,8 @@ namespace ft {
 			_allocator(alloc),
 			_node_allocator(node_allocator_type()),
 			_size(0),
-			_root(0) {
+			_root(0),
+			_max(0) {
 			TREE_DEBUG("red_black_tree default iterator called");
 		}
 
@@ -220,7 +558,8 @@ namespace ft {
 			_allocator(alloc),
 			_node_allocator(node_allocator_type()),
 			_size(0),
-			_root(0) {
+			_root(0),
+			_max(0) {
 			TREE_DEBUG("red_black_tree range constructor called");
 			this->insert(first, last);
 		}
@@ -230,7 +569,8 @@ namespace ft {
 			_allocator(copy.get_allocator()),
 			_node_allocator(copy.get_node_allocator()),
 			_size(0),
-			_root(0) {
+			_root(0),
+			_max(0) {
 			TREE_DEBUG("red_black_tree copy constructor called");
 			this->operator=(copy);
 		};
@@ -251,35 +591,35 @@ namespace ft {
 		// iterators
 
 		iterator begin() {
-			return iterator(node_type::getMinimum(this->_root), node_type::getMaximum(this->_root));
+			return iterator(node_type::getMinimum(this->_root), this->_max);
 		}
 
 		const_iterator begin() const {
-			return const_iterator(node_type::getMinimum(this->_root), node_type::getMaximum(this->_root));
+			return const_iterator(node_type::getMinimum(this->_root), this->_max);
 		}
 
 		iterator end() {
-			return iterator(NULL, node_type::getMaximum(this->_root));
+			return iterator(NULL, this->_max);
 		}
 
 		const_iterator end() const {
-			return const_iterator(NULL, node_type::getMaximum(this->_root));
+			return const_iterator(NULL, this->_max);
 		}
 
 		reverse_iterator rbegin() {
-			return reverse_iterator(iterator(NULL, node_type::getMaximum(this->_root), true));
+			return reverse_iterator(iterator(NULL, this->_max, true));
 		}
 
 		const_reverse_iterator rbegin() const {
-			return const_reverse_iterator(iterator(NULL, node_type::getMaximum(this->_root), true));
+			return const_reverse_iterator(iterator(NULL, this->_max, true));
 		}
 
 		reverse_iterator rend() {
-			return reverse_iterator(iterator(node_type::getMinimum(this->_root), node_type::getMaximum(this->_root), true));
+			return reverse_iterator(iterator(node_type::getMinimum(this->_root), this->_max, true));
 		}
 
 		const_reverse_iterator rend() const {
-			return const_reverse_iterator(iterator(node_type::getMinimum(this->_root), node_type::getMaximum(this->_root), true));
+			return const_reverse_iterator(iterator(node_type::getMinimum(this->_root), this->_max, true));
 		}
 
 		// capacity
@@ -299,26 +639,15 @@ namespace ft {
 		// modifiers
 
 		ft::pair<iterator, bool> insert(const value_type& val) {
-			if (this->empty())
-				return ft::make_pair<iterator, bool>(this->insertRoot(val), true);
-			node_pointer tmp = this->_root;
-			node_pointer parent = NULL;
-			while (tmp != NULL) {
-				parent = tmp;
-				if (this->_comp(val, parent->value))
-					tmp = tmp->left;
-				else if (this->_comp(parent->value, val))
-					tmp = tmp->right;
-				else
-					return ft::make_pair<iterator, bool>(iterator(tmp, node_type::getMaximum(this->_root)), false);
-			}
-			tmp = this->addNewNode(val, parent);
-			if (this->_comp(val, parent->value))
-				parent->left = tmp;
-			else
-				parent->right = tmp;
-			this->balanceOnInsert(tmp);
-			return ft::make_pair<iterator, bool>(iterator(tmp, node_type::getMaximum(this->_root)), true);
+			return this->insertFrom(this->_root, val);
+		}
+
+		/**
+		 * @brief Insert starting the search from hint instead of the root
+		 * (finger search). Cheap when val belongs close to hint.
+		 */
+		ft::pair<iterator, bool> insert(const_iterator hint, const value_type& val) {
+			return this->insertFrom(this->getFingerStart(hint.base(), val), val);
 		}
 
 		template<typename InputIterator>
@@ -327,6 +656,45 @@ namespace ft {
 				this->insert(*first);
 		}
 
+		/**
+		 * @brief Insert a range sorted by compare_type, each search starting
+		 * from the node touched by the previous one. k values into n cost
+		 * O(k log(n/k)) instead of O(k log n), and appending past the
+		 * current maximum needs no search at all.
+		 */
+		template<typename InputIterator>
+		void insert_sorted_batch(InputIterator first, InputIterator last) {
+			node_pointer finger = NULL;
+			for (; first != last; ++first)
+				finger = this->insertFrom(this->getFingerStart(finger, *first), *first).first.base();
+		}
+
+		/**
+		 * @brief Insert an unsorted range using several threads.
+		 * The range and the current values are gathered in a buffer, stable
+		 * sorted in parallel, deduplicated (first one wins, so existing keys
+		 * are kept like insert does) and the tree is rebuilt balanced in
+		 * linear time.
+		 * @param workers number of sorting threads, 0 for one per cpu
+		 * @note compare_type must not throw, it is called from worker threads.
+		 */
+		template<typename InputIterator>
+		void insert_parallel(InputIterator first, InputIterator last, size_type workers = 0) {
+			ft::vector<value_type> buffer;
+			ft::vector<const value_type*> values;
+			size_type n = ft::gather_sorted_unique(*this, this->_comp, first, last, workers, buffer, values);
+			if (n == 0)
+				return;
+
+			size_type red_depth = 0;
+			for (size_type i = n; i > 1; i /= 2)
+				++red_depth;
+			red_black_tree tmp(this->_comp, this->_allocator);
+			tmp.buildBalanced(values.data(), 0, n, NULL, false, 0, red_depth);
+			tmp._max = node_type::getMaximum(tmp._root);
+			this->swap(tmp);
+		}
+
 		void erase(const_iterator position) {
 			this->destroyNode(position.base());
 		}
@@ -347,6 +715,7 @@ namespace ft {
 		void swap(red_black_tree& other) {
 			if (this == &other) return;
 			std::swap(this->_root, other._root);
+			std::swap(this->_max, other._max);
 			std::swap(this->_size, other._size);
 		}
 
@@ -355,11 +724,11 @@ namespace ft {
 		}
 
 		iterator find(const value_type& val) {
-			return iterator(this->getNode(val), node_type::getMaximum(this->_root));
+			return iterator(this->getNode(val), this->_max);
 		}
 
 		const_iterator find(const value_type& val) const {
-			return const_iterator(this->getNode(val), node_type::getMaximum(this->_root));
+			return const_iterator(this->getNode(val), this->_max);
 		}
 
 		// allocator
@@ -391,6 +760,30 @@ namespace ft {
 	#endif
 
 	private:
+		/**
+		 * @brief Build a balanced subtree from sorted unique values[first, last)
+		 * by always taking the middle as subtree root.
+		 * @note Every level but the deepest one is full, so all nodes are
+		 * black except the ones at red_depth which are red (unless it is the
+		 * root). Nodes are linked to their parent as soon as they are
+		 * created so a failure leaves a tree that can still be freed.
+		 */
+		void buildBalanced(const value_type** values, size_type first, size_type last, node_pointer parent, bool isLeft, size_type depth, size_type red_depth) {
+			if (first >= last)
+				return;
+			size_type mid = first + (last - first) / 2;
+			node_pointer node = this->addNewNode(*values[mid], parent);
+			if (parent == NULL)
+				this->_root = node;
+			else if (isLeft)
+				parent->left = node;
+			else
+				parent->right = node;
+			node->color = (depth == red_depth && depth != 0) ? RED : BLACK;
+			this->buildBalanced(values, first, mid, node, true, depth + 1, red_depth);
+			this->buildBalanced(values, mid + 1, last, node, false, depth + 1, red_depth);
+		}
+
 		/**
 		 * 1: Root always as black (handled in insertRoot)
 		 * 2: New node as red (handled in add new node)
@@ -471,6 +864,64 @@ namespace ft {
 			parent->parent = left;
 		}
 
+		/**
+		 * @brief Climb from hint to the lowest ancestor whose subtree must
+		 * contain the position of val.
+		 * @note If val goes after hint only the upper bound can be wrong,
+		 * so climb until a left link leads to something bigger than val.
+		 * Mirrored when val goes before hint. Values past the maximum skip
+		 * the climb, insertFrom appends them directly.
+		 */
+		node_pointer getFingerStart(node_pointer hint, const value_type& val) const {
+			if (hint == NULL || this->_comp(this->_max->value, val))
+				return this->_root;
+			bool goRight = !this->_comp(val, hint->value);
+			node_pointer node = hint;
+			while (node->parent != NULL) {
+				node_pointer parent = node->parent;
+				if (goRight && parent->left == node && this->_comp(val, parent->value))
+					break;
+				if (!goRight && parent->right == node && this->_comp(parent->value, val))
+					break;
+				node = parent;
+			}
+			return node;
+		}
+
+		/**
+		 * @brief Insert val searching down from start
+		 * @note Values bigger than the maximum are attached to it directly,
+		 * so monotonic inserts skip the search.
+		 */
+		ft::pair<iterator, bool> insertFrom(node_pointer start, const value_type& val) {
+			if (this->empty())
+				return ft::make_pair<iterator, bool>(this->insertRoot(val), true);
+			node_pointer tmp = start;
+			node_pointer parent = NULL;
+			if (this->_comp(this->_max->value, val)) {
+				parent = this->_max;
+				tmp = NULL;
+			}
+			while (tmp != NULL) {
+				parent = tmp;
+				if (this->_comp(val, parent->value))
+					tmp = tmp->left;
+				else if (this->_comp(parent->value, val))
+					tmp = tmp->right;
+				else
+					return ft::make_pair<iterator, bool>(iterator(tmp, this->_max), false);
+			}
+			tmp = this->addNewNode(val, parent);
+			if (this->_comp(val, parent->value))
+				parent->left = tmp;
+			else
+				parent->right = tmp;
+			if (parent == this->_max && parent->right == tmp)
+				this->_max = tmp;
+			this->balanceOnInsert(tmp);
+			return ft::make_pair<iterator, bool>(iterator(tmp, this->_max), true);
+		}
+
 		node_pointer addNewNode(const value_type& val, node_pointer parent_node) {
 			node_pointer node = _node_allocator.allocate(1);
 			_node_allocator.construct(node, node_type(val, parent_node));
@@ -479,13 +930,16 @@ namespace ft {
 		}
 
 		iterator insertRoot(const value_type& val) {
-			this->_root = addNewNode(val, NULL);;
+			this->_root = addNewNode(val, NULL);
+			this->_max = this->_root;
 			return iterator(this->_root, this->_root);
 		}
 
 		void destroyNode(node_pointer node) {
 			if (node == NULL)
 				return;
+			if (node == this->_max)
+				this->_max = node_type::getPredecessor(node);
 			if (!node_type::hasChildren(node) && !node_type::isBlack(node)) {
 				this->deleteNode(node);
 			} else if (!node_type::hasChildren(node) && node_type::isBlack(node)) {
@@ -560,6 +1014,7 @@ namespace ft {
 		}
 
 		void deleteAll(node_pointer node = NULL) {
+			this->_max = NULL;
 			if (node == NULL)
 				node = this->_root;
 			if (node == NULL)
@@ -590,5 +1045,1099 @@ namespace ft {
 		node_allocator_type _node_allocator;
 		size_type _size;
 		node_pointer _root;
+		node_pointer _max;
+	};
+
+	/**
+	 * @brief Self-adjusting binary search tree.
+	 * Every insert and non-const lookup splays the touched node to the root
+	 * so keys that are accessed often stay close to it. Const lookups only
+	 * search, so like the other trees a const tree can be read from several
+	 * threads. Same interface and iterator as red_black_tree, so it can be
+	 * plugged in as the Tree of map and set.
+	 * @note The tree can degenerate into a list (e.g. after a sorted scan),
+	 * so nothing here walks it recursively. Only buildBalanced recurses, on
+	 * a tree it builds balanced.
+	 */
+	template<typename T,
+			typename Compare = ft::less<T>,
+			typename Allocator = std::allocator<T> >
+	class splay_tree {
+	public:
+		typedef ft::splay_tree_node<T>							node_type;
+		typedef T												value_type;
+		typedef Compare											compare_type;
+		typedef Allocator										allocator_type;
+		typedef typename Allocator::reference					reference;
+		typedef typename Allocator::const_reference				const_reference;
+		typedef typename Allocator::pointer						pointer;
+		typedef typename Allocator::const_pointer				const_pointer;
+		typedef ft::bst_iterator<pointer, node_type>			iterator;
+		typedef ft::bst_iterator<const_pointer, node_type>		const_iterator;
+		typedef ft::bd_reverse_iterator<iterator>				reverse_iterator;
+		typedef ft::bd_reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t									difference_type;
+		typedef	std::size_t										size_type;
+
+		typedef typename allocator_type::template rebind<node_type>::other	node_allocator_type;
+		typedef typename node_type::node_pointer							node_pointer;
+		typedef typename node_type::const_node_pointer						const_node_pointer;
+
+	public:
+		// construct/copy/destroy
+
+		explicit splay_tree(const compare_type& comp = compare_type(), const allocator_type& alloc = allocator_type()) :
+			_comp(comp),
+			_allocator(alloc),
+			_node_allocator(node_allocator_type()),
+			_size(0),
+			_root(0),
+			_max(0) {
+			TREE_DEBUG("splay_tree default constructor called");
+		}
+
+		template<typename InputIterator>
+		splay_tree(InputIterator first, InputIterator last, const compare_type& comp = compare_type(), const allocator_type& alloc = allocator_type(), typename ft::iterator_traits<InputIterator>::iterator_category* = 0) :
+			_comp(comp),
+			_allocator(alloc),
+			_node_allocator(node_allocator_type()),
+			_size(0),
+			_root(0),
+			_max(0) {
+			TREE_DEBUG("splay_tree range constructor called");
+			this->insert(first, last);
+		}
+
+		splay_tree(const splay_tree& copy) :
+			_comp(copy._comp),
+			_allocator(copy.get_allocator()),
+			_node_allocator(copy.get_node_allocator()),
+			_size(0),
+			_root(0),
+			_max(0) {
+			TREE_DEBUG("splay_tree copy constructor called");
+			this->operator=(copy);
+		}
+
+		~splay_tree() {
+			TREE_DEBUG("splay_tree deconstructor called");
+			this->deleteAll();
+		}
+
+		splay_tree& operator=(const splay_tree& other) {
+			TREE_DEBUG("splay_tree assignment operator called");
+			if (this == &other) return *this;
+			this->deleteAll();
+			this->insert(other.begin(), other.end());
+			return *this;
+		}
+
+		// iterators
+
+		iterator begin() {
+			return iterator(node_type::getMinimum(this->_root), this->_max);
+		}
+
+		const_iterator begin() const {
+			return const_iterator(node_type::getMinimum(this->_root), this->_max);
+		}
+
+		iterator end() {
+			return iterator(NULL, this->_max);
+		}
+
+		const_iterator end() const {
+			return const_iterator(NULL, this->_max);
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(iterator(NULL, this->_max, true));
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(iterator(NULL, this->_max, true));
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(iterator(node_type::getMinimum(this->_root), this->_max, true));
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(iterator(node_type::getMinimum(this->_root), this->_max, true));
+		}
+
+		// capacity
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			return this->_node_allocator.max_size();
+		}
+
+		// modifiers
+
+		ft::pair<iterator, bool> insert(const value_type& val) {
+			node_pointer tmp = this->_root;
+			node_pointer parent = NULL;
+			while (tmp != NULL) {
+				parent = tmp;
+				if (this->_comp(val, parent->value))
+					tmp = tmp->left;
+				else if (this->_comp(parent->value, val))
+					tmp = tmp->right;
+				else {
+					this->splay(tmp);
+					return ft::make_pair<iterator, bool>(iterator(tmp, this->_max), false);
+				}
+			}
+			tmp = this->addNewNode(val, parent);
+			if (parent == NULL)
+				this->_root = tmp;
+			else if (this->_comp(val, parent->value))
+				parent->left = tmp;
+			else
+				parent->right = tmp;
+			if (this->_max == NULL || this->_comp(this->_max->value, val))
+				this->_max = tmp;
+			this->splay(tmp);
+			return ft::make_pair<iterator, bool>(iterator(tmp, this->_max), true);
+		}
+
+		// @note: hint is ignored, the last touched node is already the root
+		ft::pair<iterator, bool> insert(const_iterator hint, const value_type& val) {
+			(void)hint;
+			return this->insert(val);
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			for (; first != last; ++first)
+				this->insert(*first);
+		}
+
+		/**
+		 * @brief Insert a range sorted by compare_type. Each value lands next
+		 * to the previous one, which was just splayed to the root, so this
+		 * is a plain insert loop.
+		 */
+		template<typename InputIterator>
+		void insert_sorted_batch(InputIterator first, InputIterator last) {
+			this->insert(first, last);
+		}
+
+		/**
+		 * @brief Insert an unsorted range using several threads, same as
+		 * red_black_tree::insert_parallel. The rebuilt tree is balanced, the
+		 * following lookups reshape it again.
+		 * @param workers number of sorting threads, 0 for one per cpu
+		 * @note compare_type must not throw, it is called from worker threads.
+		 */
+		template<typename InputIterator>
+		void insert_parallel(InputIterator first, InputIterator last, size_type workers = 0) {
+			ft::vector<value_type> buffer;
+			ft::vector<const value_type*> values;
+			size_type n = ft::gather_sorted_unique(*this, this->_comp, first, last, workers, buffer, values);
+			if (n == 0)
+				return;
+
+			splay_tree tmp(this->_comp, this->_allocator);
+			tmp.buildBalanced(values.data(), 0, n, NULL, false);
+			tmp._max = node_type::getMaximum(tmp._root);
+			this->swap(tmp);
+		}
+
+		void erase(const_iterator position) {
+			this->destroyNode(position.base());
+		}
+
+		size_type erase(const value_type& val) {
+			node_pointer to_delete = this->getNode(val);
+			if (to_delete == NULL)
+				return 0;
+			this->destroyNode(to_delete);
+			return 1;
+		}
+
+		void erase(const_iterator first, const_iterator last) {
+			while (first != last)
+				this->destroyNode((first++).base());
+		}
+
+		void swap(splay_tree& other) {
+			if (this == &other) return;
+			std::swap(this->_root, other._root);
+			std::swap(this->_max, other._max);
+			std::swap(this->_size, other._size);
+		}
+
+		void clear() {
+			this->deleteAll();
+		}
+
+		iterator find(const value_type& val) {
+			return iterator(this->getNode(val), this->_max);
+		}
+
+		/**
+		 * @note Does not splay: a const lookup never modifies the tree, so
+		 * const finds from several threads are safe as with the other trees.
+		 */
+		const_iterator find(const value_type& val) const {
+			return const_iterator(this->searchNode(val), this->_max);
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+		node_allocator_type get_node_allocator() const {
+			return node_allocator_type(this->_node_allocator);
+		}
+
+	private:
+		/**
+		 * @brief Rotate node one level up, over its parent.
+		 */
+		void rotateUp(node_pointer node) {
+			node_pointer parent = node->parent;
+			node_pointer grand_parent = parent->parent;
+			if (parent->left == node) {
+				parent->left = node->right;
+				if (node->right != NULL)
+					node->right->parent = parent;
+				node->right = parent;
+			} else {
+				parent->right = node->left;
+				if (node->left != NULL)
+					node->left->parent = parent;
+				node->left = parent;
+			}
+			parent->parent = node;
+			node->parent = grand_parent;
+			if (grand_parent != NULL) {
+				if (grand_parent->left == parent)
+					grand_parent->left = node;
+				else
+					grand_parent->right = node;
+			}
+		}
+
+		/**
+		 * @brief Bring node to the root with zig, zig-zig and zig-zag steps.
+		 * @note Only the links move, node addresses stay the same so
+		 * iterators are not invalidated.
+		 */
+		void splay(node_pointer node) {
+			while (node->parent != NULL) {
+				node_pointer parent = node->parent;
+				node_pointer grand_parent = parent->parent;
+				if (grand_parent != NULL) {
+					if ((grand_parent->left == parent) == (parent->left == node))
+						this->rotateUp(parent);
+					else
+						this->rotateUp(node);
+				}
+				this->rotateUp(node);
+			}
+			this->_root = node;
+		}
+
+		node_pointer addNewNode(const value_type& val, node_pointer parent_node) {
+			node_pointer node = _node_allocator.allocate(1);
+			_node_allocator.construct(node, node_type(val, parent_node));
+			this->_size++;
+			return node;
+		}
+
+		/**
+		 * @brief Build a balanced subtree from sorted unique values[first, last)
+		 * by always taking the middle as subtree root.
+		 */
+		void buildBalanced(const value_type** values, size_type first, size_type last, node_pointer parent, bool isLeft) {
+			if (first >= last)
+				return;
+			size_type mid = first + (last - first) / 2;
+			node_pointer node = this->addNewNode(*values[mid], parent);
+			if (parent == NULL)
+				this->_root = node;
+			else if (isLeft)
+				parent->left = node;
+			else
+				parent->right = node;
+			this->buildBalanced(values, first, mid, node, true);
+			this->buildBalanced(values, mid + 1, last, node, false);
+		}
+
+		/**
+		 * @brief Splay node to the root then join its two subtrees by
+		 * splaying the maximum of the left one.
+		 */
+		void destroyNode(node_pointer node) {
+			if (node == NULL)
+				return;
+			if (node == this->_max)
+				this->_max = node_type::getPredecessor(node);
+			this->splay(node);
+			node_pointer left = node->left;
+			node_pointer right = node->right;
+			if (left == NULL) {
+				this->_root = right;
+				if (right != NULL)
+					right->parent = NULL;
+			} else {
+				left->parent = NULL;
+				this->splay(node_type::getMaximum(left));
+				this->_root->right = right;
+				if (right != NULL)
+					right->parent = this->_root;
+			}
+			_node_allocator.destroy(node);
+			_node_allocator.deallocate(node, 1);
+			this->_size--;
+		}
+
+		/**
+		 * @brief Free every node without recursion by rotating left
+		 * children away until the tree is a right-leaning list.
+		 */
+		void deleteAll() {
+			node_pointer node = this->_root;
+			while (node != NULL) {
+				if (node->left != NULL) {
+					node_pointer left = node->left;
+					node->left = left->right;
+					left->right = node;
+					node = left;
+				} else {
+					node_pointer next = node->right;
+					_node_allocator.destroy(node);
+					_node_allocator.deallocate(node, 1);
+					node = next;
+				}
+			}
+			this->_root = NULL;
+			this->_max = NULL;
+			this->_size = 0;
+		}
+
+		/**
+		 * @brief Look up val and splay the node found, or the last node
+		 * visited if val is not in the tree.
+		 */
+		node_pointer getNode(const value_type& val) {
+			node_pointer tmp = this->_root;
+			node_pointer last = NULL;
+			while (tmp != NULL) {
+				last = tmp;
+				if (this->_comp(val, tmp->value))
+					tmp = tmp->left;
+				else if (this->_comp(tmp->value, val))
+					tmp = tmp->right;
+				else
+					break;
+			}
+			if (last != NULL)
+				this->splay(last);
+			return tmp;
+		}
+
+		/**
+		 * @brief Plain binary search, leaves the tree untouched.
+		 */
+		node_pointer searchNode(const value_type& val) const {
+			node_pointer tmp = this->_root;
+			while (tmp != NULL) {
+				if (this->_comp(val, tmp->value))
+					tmp = tmp->left;
+				else if (this->_comp(tmp->value, val))
+					tmp = tmp->right;
+				else
+					break;
+			}
+			return tmp;
+		}
+
+	protected:
+		compare_type _comp;
+		allocator_type _allocator;
+		node_allocator_type _node_allocator;
+		size_type _size;
+		node_pointer _root;
+		node_pointer _max;
+	};
+
+	/**
+	 * @brief Red black tree whose nodes link to each other with 32-bit
+	 * indices into an arena (see compact_rb_tree_arena).
+	 * Same balancing as red_black_tree, with roughly half the link overhead
+	 * per node. The links are one flat ft::vector that is reallocated as it
+	 * grows, the values sit in chunks that never move, so references and
+	 * pointers to elements stay valid across inserts like with the pointer
+	 * based trees. The arena itself is heap allocated, so swap() exchanges
+	 * two pointers and iterators stay valid across it.
+	 * Erased slots go to a free list and are reused by the next insert.
+	 */
+	template<typename T,
+			typename Compare = ft::less<T>,
+			typename Allocator = std::allocator<T> >
+	class compact_red_black_tree {
+	public:
+		typedef ft::compact_rb_tree_node<T>						node_type;
+		typedef T												value_type;
+		typedef Compare											compare_type;
+		typedef Allocator										allocator_type;
+		typedef typename Allocator::reference					reference;
+		typedef typename Allocator::const_reference				const_reference;
+		typedef typename Allocator::pointer						pointer;
+		typedef typename Allocator::const_pointer				const_pointer;
+		typedef std::ptrdiff_t									difference_type;
+		typedef	std::size_t										size_type;
+
+		typedef ft::compact_rb_tree_arena<T, Allocator>						arena_type;
+		typedef typename arena_type::node_allocator_type					node_allocator_type;
+		typedef typename allocator_type::template rebind<arena_type>::other	arena_allocator_type;
+		typedef typename node_type::index_type								index_type;
+
+		typedef ft::compact_bst_iterator<pointer, node_type, arena_type>		iterator;
+		typedef ft::compact_bst_iterator<const_pointer, node_type, arena_type>	const_iterator;
+		typedef ft::bd_reverse_iterator<iterator>								reverse_iterator;
+		typedef ft::bd_reverse_iterator<const_iterator>							const_reverse_iterator;
+
+	public:
+		// construct/copy/destroy
+
+		explicit compact_red_black_tree(const compare_type& comp = compare_type(), const allocator_type& alloc = allocator_type()) :
+			_comp(comp),
+			_allocator(alloc),
+			_nodes(newArena(this->_allocator)),
+			_size(0),
+			_root(node_type::npos),
+			_max(node_type::npos),
+			_free(node_type::npos) {
+			TREE_DEBUG("compact_red_black_tree default constructor called");
+		}
+
+		template<typename InputIterator>
+		compact_red_black_tree(InputIterator first, InputIterator last, const compare_type& comp = compare_type(), const allocator_type& alloc = allocator_type(), typename ft::iterator_traits<InputIterator>::iterator_category* = 0) :
+			_comp(comp),
+			_allocator(alloc),
+			_nodes(newArena(this->_allocator)),
+			_size(0),
+			_root(node_type::npos),
+			_max(node_type::npos),
+			_free(node_type::npos) {
+			TREE_DEBUG("compact_red_black_tree range constructor called");
+			try {
+				this->insert(first, last);
+			} catch (...) {
+				deleteArena(this->_nodes, this->_allocator);
+				throw;
+			}
+		}
+
+		compact_red_black_tree(const compact_red_black_tree& copy) :
+			_comp(copy._comp),
+			_allocator(copy.get_allocator()),
+			_nodes(newArena(this->_allocator)),
+			_size(0),
+			_root(node_type::npos),
+			_max(node_type::npos),
+			_free(node_type::npos) {
+			TREE_DEBUG("compact_red_black_tree copy constructor called");
+			try {
+				this->operator=(copy);
+			} catch (...) {
+				deleteArena(this->_nodes, this->_allocator);
+				throw;
+			}
+		}
+
+		~compact_red_black_tree() {
+			TREE_DEBUG("compact_red_black_tree deconstructor called");
+			deleteArena(this->_nodes, this->_allocator);
+		}
+
+		/**
+		 * @brief Copy the arena slot by slot, links are indices so the copy
+		 * has the same shape without any rebalancing.
+		 */
+		compact_red_black_tree& operator=(const compact_red_black_tree& other) {
+			TREE_DEBUG("compact_red_black_tree assignment operator called");
+			if (this == &other) return *this;
+			this->deleteAll();
+			try {
+				this->nodes().copy(other.nodes());
+			} catch (...) {
+				this->deleteAll();
+				throw;
+			}
+			this->_size = other._size;
+			this->_root = other._root;
+			this->_max = other._max;
+			this->_free = other._free;
+			return *this;
+		}
+
+		// iterators
+
+		iterator begin() {
+			return iterator(this->_nodes, node_type::getMinimum(this->nodes(), this->_root), this->getTail());
+		}
+
+		const_iterator begin() const {
+			return const_iterator(this->arena(), node_type::getMinimum(this->nodes(), this->_root), this->getTail());
+		}
+
+		iterator end() {
+			return iterator(this->_nodes, node_type::npos, this->getTail());
+		}
+
+		const_iterator end() const {
+			return const_iterator(this->arena(), node_type::npos, this->getTail());
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(iterator(this->_nodes, node_type::npos, this->getTail(), true));
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(const_iterator(this->arena(), node_type::npos, this->getTail(), true));
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(iterator(this->_nodes, node_type::getMinimum(this->nodes(), this->_root), this->getTail(), true));
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(const_iterator(this->arena(), node_type::getMinimum(this->nodes(), this->_root), this->getTail(), true));
+		}
+
+		// capacity
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			return std::min<size_type>(this->nodes().max_size(), node_type::npos - 1);
+		}
+
+		// modifiers
+
+		ft::pair<iterator, bool> insert(const value_type& val) {
+			return this->insertFrom(this->_root, val);
+		}
+
+		/**
+		 * @brief Insert starting the search from hint instead of the root
+		 * (finger search). Cheap when val belongs close to hint.
+		 */
+		ft::pair<iterator, bool> insert(const_iterator hint, const value_type& val) {
+			return this->insertFrom(this->getFingerStart(hint.base(), val), val);
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			for (; first != last; ++first)
+				this->insert(*first);
+		}
+
+		/**
+		 * @brief Insert a range sorted by compare_type, each search starting
+		 * from the node touched by the previous one.
+		 */
+		template<typename InputIterator>
+		void insert_sorted_batch(InputIterator first, InputIterator last) {
+			index_type finger = node_type::npos;
+			for (; first != last; ++first)
+				finger = this->insertFrom(this->getFingerStart(finger, *first), *first).first.base();
+		}
+
+		/**
+		 * @brief Insert an unsorted range using several threads, same as
+		 * red_black_tree::insert_parallel. The rebuilt arena has no free
+		 * slots and stores the nodes in pre-order.
+		 * @param workers number of sorting threads, 0 for one per cpu
+		 * @note compare_type must not throw, it is called from worker threads.
+		 */
+		template<typename InputIterator>
+		void insert_parallel(InputIterator first, InputIterator last, size_type workers = 0) {
+			ft::vector<value_type> buffer;
+			ft::vector<const value_type*> values;
+			size_type n = ft::gather_sorted_unique(*this, this->_comp, first, last, workers, buffer, values);
+			if (n == 0)
+				return;
+			if (n >= node_type::npos - 1)
+				throw std::length_error("compact_red_black_tree: too many nodes");
+
+			size_type red_depth = 0;
+			for (size_type i = n; i > 1; i /= 2)
+				++red_depth;
+			compact_red_black_tree tmp(this->_comp, this->_allocator);
+			tmp.nodes().reserve(n);
+			tmp.buildBalanced(values.data(), 0, n, node_type::npos, false, 0, red_depth);
+			tmp._max = node_type::getMaximum(tmp.nodes(), tmp._root);
+			this->swap(tmp);
+		}
+
+		void erase(const_iterator position) {
+			this->destroyNode(position.base());
+		}
+
+		size_type erase(const value_type& val) {
+			index_type to_delete = this->getNode(val);
+			if (to_delete == node_type::npos)
+				return 0;
+			this->destroyNode(to_delete);
+			return 1;
+		}
+
+		void erase(const_iterator first, const_iterator last) {
+			while (first != last)
+				this->destroyNode((first++).base());
+		}
+
+		void swap(compact_red_black_tree& other) {
+			if (this == &other) return;
+			std::swap(this->_nodes, other._nodes);
+			std::swap(this->_root, other._root);
+			std::swap(this->_max, other._max);
+			std::swap(this->_free, other._free);
+			std::swap(this->_size, other._size);
+		}
+
+		void clear() {
+			this->deleteAll();
+		}
+
+		iterator find(const value_type& val) {
+			return iterator(this->_nodes, this->getNode(val), this->getTail());
+		}
+
+		const_iterator find(const value_type& val) const {
+			return const_iterator(this->arena(), this->getNode(val), this->getTail());
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+		node_allocator_type get_node_allocator() const {
+			return this->nodes().get_allocator();
+		}
+
+	private:
+		/**
+		 * @brief The arena lives on the heap so swap() only exchanges the
+		 * pointers. Iterators hold the arena pointer, so they keep following
+		 * their element into the other tree like the pointer based trees.
+		 */
+		static arena_type* newArena(const allocator_type& value_alloc) {
+			arena_allocator_type alloc(value_alloc);
+			arena_type* arena = alloc.allocate(1);
+			try {
+				new (static_cast<void*>(arena)) arena_type(value_alloc);
+			} catch (...) {
+				alloc.deallocate(arena, 1);
+				throw;
+			}
+			return arena;
+		}
+
+		static void deleteArena(arena_type* arena, const allocator_type& value_alloc) {
+			arena_allocator_type alloc(value_alloc);
+			arena->~arena_type();
+			alloc.deallocate(arena, 1);
+		}
+
+		arena_type& nodes() {
+			return *this->_nodes;
+		}
+
+		const arena_type& nodes() const {
+			return *this->_nodes;
+		}
+
+		arena_type* arena() const {
+			return this->_nodes;
+		}
+
+		index_type getTail() const {
+			return this->_max;
+		}
+
+		/**
+		 * Same climb as red_black_tree::getFingerStart
+		 */
+		index_type getFingerStart(index_type hint, const value_type& val) const {
+			if (hint == node_type::npos || this->_comp(this->nodes().value(this->_max), val))
+				return this->_root;
+			bool goRight = !this->_comp(val, this->nodes().value(hint));
+			index_type node = hint;
+			while (this->parentOf(node) != node_type::npos) {
+				index_type parent = this->parentOf(node);
+				if (goRight && this->nodes()[parent].left == node && this->_comp(val, this->nodes().value(parent)))
+					break;
+				if (!goRight && this->nodes()[parent].right == node && this->_comp(this->nodes().value(parent), val))
+					break;
+				node = parent;
+			}
+			return node;
+		}
+
+		ft::pair<iterator, bool> insertFrom(index_type start, const value_type& val) {
+			if (this->empty()) {
+				this->_root = this->addNewNode(val, node_type::npos);
+				this->_max = this->_root;
+				return ft::make_pair<iterator, bool>(iterator(this->_nodes, this->_root, this->_root), true);
+			}
+			index_type tmp = start;
+			index_type parent = node_type::npos;
+			if (this->_comp(this->nodes().value(this->_max), val)) {
+				parent = this->_max;
+				tmp = node_type::npos;
+			}
+			while (tmp != node_type::npos) {
+				parent = tmp;
+				if (this->_comp(val, this->nodes().value(parent)))
+					tmp = this->nodes()[tmp].left;
+				else if (this->_comp(this->nodes().value(parent), val))
+					tmp = this->nodes()[tmp].right;
+				else
+					return ft::make_pair<iterator, bool>(iterator(this->_nodes, tmp, this->getTail()), false);
+			}
+			tmp = this->addNewNode(val, parent);
+			if (this->_comp(val, this->nodes().value(parent)))
+				this->nodes()[parent].left = tmp;
+			else
+				this->nodes()[parent].right = tmp;
+			if (parent == this->_max && this->nodes()[parent].right == tmp)
+				this->_max = tmp;
+			this->balanceOnInsert(tmp);
+			return ft::make_pair<iterator, bool>(iterator(this->_nodes, tmp, this->getTail()), true);
+		}
+
+		index_type parentOf(index_type node) const {
+			return this->nodes()[node].getParent();
+		}
+
+		bool isBlack(index_type node) const {
+			return (node == node_type::npos || this->nodes()[node].getColor() == BLACK);
+		}
+
+		bool hasChildren(index_type node) const {
+			return (this->nodes()[node].left != node_type::npos || this->nodes()[node].right != node_type::npos);
+		}
+
+		void swapNodeColor(index_type node1, index_type node2) {
+			rb_tree_color tmp = this->isBlack(node1) ? BLACK : RED;
+			if (node1 != node_type::npos)
+				this->nodes()[node1].setColor(this->isBlack(node2) ? BLACK : RED);
+			if (node2 != node_type::npos)
+				this->nodes()[node2].setColor(tmp);
+		}
+
+		/**
+		 * @brief Index version of rb_tree_node::swapNodeValue, swaps the
+		 * position and color of two nodes in the tree.
+		 * @return false if node1 was the root
+		 */
+		bool swapNodeValue(index_type node1, index_type node2) {
+			const index_type npos = node_type::npos;
+			this->swapNodeColor(node1, node2);
+
+			index_type parent1 = this->parentOf(node1);
+			index_type node1Left = this->nodes()[node1].left;
+			index_type node1Right = this->nodes()[node1].right;
+			index_type parent2 = this->parentOf(node2);
+			index_type node2Left = this->nodes()[node2].left;
+			index_type node2Right = this->nodes()[node2].right;
+
+			if (parent1 != npos && this->nodes()[parent1].left == node1)
+				this->nodes()[parent1].left = node2;
+			else if (parent1 != npos)
+				this->nodes()[parent1].right = node2;
+			this->nodes()[node2].setParent(parent1);
+
+			if (parent2 != npos && this->nodes()[parent2].left == node2)
+				this->nodes()[parent2].left = node1;
+			else if (parent2 != npos)
+				this->nodes()[parent2].right = node1;
+			if (parent2 != node1)
+				this->nodes()[node1].setParent(parent2);
+			else
+				this->nodes()[node1].setParent(node2);
+
+			if (node1Left == node2) {
+				this->nodes()[node2].left = node1;
+				this->nodes()[node2].right = node1Right;
+			} else if (node1Right == node2) {
+				this->nodes()[node2].right = node1;
+				this->nodes()[node2].left = node1Left;
+			} else {
+				this->nodes()[node2].left = node1Left;
+				this->nodes()[node2].right = node1Right;
+			}
+
+			if (node1Right != npos && node1Right != node2)
+				this->nodes()[node1Right].setParent(node2);
+			if (node1Left != npos && node1Left != node2)
+				this->nodes()[node1Left].setParent(node2);
+
+			this->nodes()[node1].left = node2Left;
+			if (node2Left != npos)
+				this->nodes()[node2Left].setParent(node1);
+			this->nodes()[node1].right = node2Right;
+			if (node2Right != npos)
+				this->nodes()[node2Right].setParent(node1);
+
+			return parent1 != npos;
+		}
+
+		/**
+		 * Same cases as red_black_tree::balanceOnInsert
+		 */
+		void balanceOnInsert(index_type new_node) {
+			if (this->isBlack(this->parentOf(new_node)))
+				return;
+			index_type parent = this->parentOf(new_node);
+			index_type grand_parent = this->parentOf(parent);
+			index_type parent_sibling = this->nodes()[grand_parent].left == parent ? this->nodes()[grand_parent].right : this->nodes()[grand_parent].left;
+			if (this->isBlack(parent_sibling))
+				this->rotateAndRecolor(new_node);
+			else {
+				this->nodes()[parent_sibling].setColor(BLACK);
+				this->nodes()[parent].setColor(BLACK);
+				if (this->parentOf(grand_parent) != node_type::npos) {
+					this->nodes()[grand_parent].setColor(RED);
+					this->balanceOnInsert(grand_parent);
+				}
+			}
+		}
+
+		void rotateAndRecolor(index_type new_node) {
+			index_type parent = this->parentOf(new_node);
+			index_type grand_parent = this->parentOf(parent);
+			if (this->nodes()[grand_parent].left == parent) {
+				if (this->nodes()[parent].right == new_node) {
+					new_node = parent;
+					this->rotateNodeLeft(new_node);
+				}
+				this->nodes()[this->parentOf(new_node)].setColor(BLACK);
+				this->nodes()[grand_parent].setColor(RED);
+				this->rotateNodeRight(grand_parent);
+			} else {
+				if (this->nodes()[parent].left == new_node) {
+					new_node = parent;
+					this->rotateNodeRight(new_node);
+				}
+				this->nodes()[this->parentOf(new_node)].setColor(BLACK);
+				this->nodes()[grand_parent].setColor(RED);
+				this->rotateNodeLeft(grand_parent);
+			}
+		}
+
+		void rotateNodeLeft(index_type parent) {
+			index_type right = this->nodes()[parent].right;
+			index_type grand_parent = this->parentOf(parent);
+			this->nodes()[parent].right = this->nodes()[right].left;
+			if (this->nodes()[right].left != node_type::npos)
+				this->nodes()[this->nodes()[right].left].setParent(parent);
+			this->nodes()[right].setParent(grand_parent);
+			if (parent == this->_root)
+				this->_root = right;
+			else if (parent == this->nodes()[grand_parent].right)
+				this->nodes()[grand_parent].right = right;
+			else
+				this->nodes()[grand_parent].left = right;
+			this->nodes()[right].left = parent;
+			this->nodes()[parent].setParent(right);
+		}
+
+		void rotateNodeRight(index_type parent) {
+			index_type left = this->nodes()[parent].left;
+			index_type grand_parent = this->parentOf(parent);
+			this->nodes()[parent].left = this->nodes()[left].right;
+			if (this->nodes()[left].right != node_type::npos)
+				this->nodes()[this->nodes()[left].right].setParent(parent);
+			this->nodes()[left].setParent(grand_parent);
+			if (parent == this->_root)
+				this->_root = left;
+			else if (parent == this->nodes()[grand_parent].right)
+				this->nodes()[grand_parent].right = left;
+			else
+				this->nodes()[grand_parent].left = left;
+			this->nodes()[left].right = parent;
+			this->nodes()[parent].setParent(left);
+		}
+
+		/**
+		 * @brief Take a slot from the free list, or append one to the arena
+		 * @exception length_error if the tree is out of indices
+		 */
+		index_type addNewNode(const value_type& val, index_type parent_node) {
+			index_type node = this->_free;
+			if (node != node_type::npos) {
+				index_type next_free = this->nodes()[node].right;
+				this->nodes().reuse(node, val, parent_node);
+				this->_free = next_free;
+			} else {
+				if (this->nodes().size() >= node_type::npos - 1)
+					throw std::length_error("compact_red_black_tree: too many nodes");
+				node = static_cast<index_type>(this->nodes().size());
+				this->nodes().push_back(val, parent_node);
+			}
+			this->_size++;
+			return node;
+		}
+
+		void destroyNode(index_type node) {
+			if (node == node_type::npos)
+				return;
+			if (node == this->_max)
+				this->_max = node_type::getPredecessor(this->nodes(), node);
+			if (!this->hasChildren(node) && !this->isBlack(node)) {
+				this->deleteNode(node);
+			} else if (!this->hasChildren(node) && this->isBlack(node)) {
+				this->resolveDoubleBlack(node);
+				this->deleteNode(node);
+			} else {
+				index_type next = this->nodes()[node].left != node_type::npos ? node_type::getPredecessor(this->nodes(), node) : node_type::getSuccessor(this->nodes(), node);
+				if (!this->swapNodeValue(node, next))
+					this->_root = next;
+				this->destroyNode(node);
+			}
+		}
+
+		/**
+		 * Same as red_black_tree::buildBalanced, with indices
+		 */
+		void buildBalanced(const value_type** values, size_type first, size_type last, index_type parent, bool isLeft, size_type depth, size_type red_depth) {
+			if (first >= last)
+				return;
+			size_type mid = first + (last - first) / 2;
+			index_type node = this->addNewNode(*values[mid], parent);
+			if (parent == node_type::npos)
+				this->_root = node;
+			else if (isLeft)
+				this->nodes()[parent].left = node;
+			else
+				this->nodes()[parent].right = node;
+			this->nodes()[node].setColor((depth == red_depth && depth != 0) ? RED : BLACK);
+			this->buildBalanced(values, first, mid, node, true, depth + 1, red_depth);
+			this->buildBalanced(values, mid + 1, last, node, false, depth + 1, red_depth);
+		}
+
+		/**
+		 * @brief Unlink a leaf, destroy its value and push its slot on the
+		 * free list
+		 */
+		void deleteNode(index_type node) {
+			index_type parent = this->parentOf(node);
+			if (parent == node_type::npos)
+				this->_root = node_type::npos;
+			else if (this->nodes()[parent].left == node)
+				this->nodes()[parent].left = node_type::npos;
+			else if (this->nodes()[parent].right == node)
+				this->nodes()[parent].right = node_type::npos;
+			this->nodes().release(node);
+			this->nodes()[node].right = this->_free;
+			this->_free = node;
+			this->_size--;
+			if (this->_size == 0)
+				this->deleteAll();
+		}
+
+		void resolveDoubleBlack(index_type node) {
+			if (node == this->_root)
+				return;
+			index_type parent = this->parentOf(node);
+			index_type sibling = this->nodes()[parent].left == node ? this->nodes()[parent].right : this->nodes()[parent].left;
+			if (!this->isBlack(sibling)) {
+				this->swapNodeColor(parent, sibling);
+				if (this->nodes()[parent].left == node)
+					this->rotateNodeLeft(parent);
+				else
+					this->rotateNodeRight(parent);
+				return this->resolveDoubleBlack(node);
+			} else {
+				if (sibling == node_type::npos || (this->isBlack(this->nodes()[sibling].left) && this->isBlack(this->nodes()[sibling].right))) {
+					if (sibling != node_type::npos)
+						this->nodes()[sibling].setColor(RED);
+					if (!this->isBlack(parent))
+						this->nodes()[parent].setColor(BLACK);
+					else
+						return this->resolveDoubleBlack(parent);
+				} else if ((this->nodes()[parent].left == node && !this->isBlack(this->nodes()[sibling].left) && this->isBlack(this->nodes()[sibling].right))
+						|| (this->nodes()[parent].right == node && !this->isBlack(this->nodes()[sibling].right) && this->isBlack(this->nodes()[sibling].left))) {
+					if (this->nodes()[parent].left == node) {
+						this->swapNodeColor(sibling, this->nodes()[sibling].left);
+						this->rotateNodeRight(sibling);
+					} else {
+						this->swapNodeColor(sibling, this->nodes()[sibling].right);
+						this->rotateNodeLeft(sibling);
+					}
+					return this->resolveDoubleBlack(node);
+				} else if ((this->nodes()[parent].left == node && !this->isBlack(this->nodes()[sibling].right))
+						|| (this->nodes()[parent].right == node && !this->isBlack(this->nodes()[sibling].left))) {
+					if (this->nodes()[parent].left == node) {
+						this->swapNodeColor(sibling, parent);
+						this->rotateNodeLeft(parent);
+						this->nodes()[this->nodes()[sibling].right].setColor(BLACK);
+					} else {
+						this->swapNodeColor(sibling, parent);
+						this->rotateNodeRight(parent);
+						this->nodes()[this->nodes()[sibling].left].setColor(BLACK);
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Drop the whole arena at once, no tree walk needed
+		 */
+		void deleteAll() {
+			this->nodes().clear();
+			this->_size = 0;
+			this->_root = node_type::npos;
+			this->_max = node_type::npos;
+			this->_free = node_type::npos;
+		}
+
+		index_type getNode(const value_type& val) const {
+			index_type tmp = this->_root;
+			while (tmp != node_type::npos) {
+				if (this->_comp(val, this->nodes().value(tmp)))
+					tmp = this->nodes()[tmp].left;
+				else if (this->_comp(this->nodes().value(tmp), val))
+					tmp = this->nodes()[tmp].right;
+				else
+					return tmp;
+			}
+			return node_type::npos;
+		}
+
+	protected:
+		compare_type _comp;
+		allocator_type _allocator;
+		arena_type* _nodes;
+		size_type _size;
+		index_type _root;
+		index_type _max;
+		index_type _free;
 	};
 }
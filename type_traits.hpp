@@ -45,6 +45,74 @@ namespace ft {
 	template<> struct is_integral<unsigned long> :		public true_type {};
 	// template<> struct is_integral<unsigned long long> :	public true_type {}; // C++11
 
+	// is_floating_point
+	template<typename T> struct is_floating_point :	public false_type {};
+	template<> struct is_floating_point<float> :		public true_type {};
+	template<> struct is_floating_point<double> :		public true_type {};
+	template<> struct is_floating_point<long double> :	public true_type {};
+
+	// is_arithmetic
+	template<typename T>
+	struct is_arithmetic : public integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value> {};
+
+	// is_trivially_copyable
+	// C++98 has no way to detect it, so only arithmetic types and pointers
+	// are known to be. Containers use memcpy/memmove for types where this is
+	// true, opt your own POD types in with a specialization:
+	// namespace ft { template<> struct is_trivially_copyable<my_pod> : public true_type {}; }
+	template<typename T>
+	struct is_trivially_copyable : public integral_constant<bool, is_arithmetic<T>::value> {};
+	template<typename T> struct is_trivially_copyable<T*> :		public true_type {};
+	template<typename T> struct is_trivially_copyable<const T> :	public is_trivially_copyable<T> {};
+
+	// is_trivially_destructible
+	// Anything trivially copyable is, other types can be opted in the same way
+	template<typename T>
+	struct is_trivially_destructible : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+	// is_trivially_default_constructible
+	// Types whose new elements may be left uninitialized, same defaults and
+	// opt-in as is_trivially_copyable
+	template<typename T>
+	struct is_trivially_default_constructible : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+	// compile_time_check
+	// C++98 static_assert: sizeof(compile_time_check<false>) doesn't compile
+	template<bool> struct compile_time_check;
+	template<> struct compile_time_check<true> {};
+
+	// alignment_of
+	// C++98 version: the padding the compiler puts between a char and a T
+	template<typename T>
+	struct alignment_of {
+	private:
+		struct holder { char c; T t; };
+
+	public:
+		static const std::size_t value = sizeof(holder) - sizeof(T);
+	};
+
+	// aligned_storage
+	// Raw bytes to placement-new a T into, type is a POD union of Len bytes
+	// aligned like the fundamental type with alignment Align
+	template<std::size_t Align> struct aligned_type {	typedef long double type; };
+	template<> struct aligned_type<1> {					typedef char type; };
+	template<> struct aligned_type<2> {					typedef short type; };
+	template<> struct aligned_type<4> {					typedef int type; };
+	template<> struct aligned_type<8> {					typedef double type; };
+
+	template<std::size_t Len, std::size_t Align>
+	struct aligned_storage {
+		union type {
+			unsigned char data[Len];
+			typename aligned_type<Align>::type align;
+		};
+	};
+
+	// remove_const
+	template<typename T> struct remove_const {			typedef T type; };
+	template<typename T> struct remove_const<const T> {	typedef T type; };
+
 	// Compare for equality of types.
 	template<typename, typename> struct are_same : public false_type {};
 	template<typename T> struct are_same<T, T> : public true_type {};
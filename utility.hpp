@@ -1,5 +1,7 @@
 #pragma once
 
+#include "type_traits.hpp"
+
 namespace ft {
 	// ft::pair
 	template<typename T1, typename T2>
@@ -12,6 +14,8 @@ namespace ft {
 
 		pair() : first(), second() {}
 
+		pair(const pair& pr) : first(pr.first), second(pr.second) {}
+
 		template<class U, class V>
 		pair(const pair<U, V>& pr) : first(pr.first), second(pr.second) {}
 
@@ -55,6 +59,11 @@ namespace ft {
 		return !(lhs < rhs);
 	}
 
+	// a pair is just its two members, copying it bytewise is fine when both are
+	template<typename T1, typename T2>
+	struct is_trivially_copyable<pair<T1, T2> > :
+		public integral_constant<bool, is_trivially_copyable<T1>::value && is_trivially_copyable<T2>::value> {};
+
 	// ft::make_pair()
 	template<typename T1, typename T2>
 	pair<T1, T2> make_pair(T1 x, T2 y) {
@@ -4,11 +4,21 @@
 #include "type_traits.hpp"
 #include "utility.hpp"
 #include "algorithm.hpp"
+#include "memory.hpp"
 
 #include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <istream>
+#include <string>
+#include <unistd.h>
+#if __cplusplus >= 201103L
+#include <utility>
+#include <type_traits>
+#endif
 
 #ifdef VECTOR_DEBUG
 #include <iostream>
@@ -18,7 +28,83 @@
 #endif
 
 namespace ft {
-	template< typename T, typename Allocator = std::allocator<T> >
+	// Growth policies, they pick the new capacity once a vector is full.
+	// next_capacity gets the current capacity and size, the number of
+	// elements that must fit on top of size and sizeof(value_type). The
+	// vector clamps the result between size + extend and max_size().
+
+	/**
+	 * @brief Double the capacity (or grow by extend if bigger). Default,
+	 * same as clang. gcc does size + max(size, extend).
+	 */
+	struct vector_growth_double {
+		static std::size_t next_capacity(std::size_t capacity, std::size_t size, std::size_t extend, std::size_t element_size) {
+			(void)size;
+			(void)element_size;
+			return capacity + std::max(capacity, extend);
+		}
+	};
+
+	/**
+	 * @brief Grow by half the capacity, less slack memory than doubling
+	 * and freed blocks can be reused by later growth.
+	 */
+	struct vector_growth_one_and_half {
+		static std::size_t next_capacity(std::size_t capacity, std::size_t size, std::size_t extend, std::size_t element_size) {
+			(void)size;
+			(void)element_size;
+			return capacity + std::max(capacity / 2, extend);
+		}
+	};
+
+	/**
+	 * @brief Grow by about the golden ratio (x1.625).
+	 */
+	struct vector_growth_golden {
+		static std::size_t next_capacity(std::size_t capacity, std::size_t size, std::size_t extend, std::size_t element_size) {
+			(void)size;
+			(void)element_size;
+			return capacity + std::max(capacity / 2 + capacity / 8, extend);
+		}
+	};
+
+	/**
+	 * @brief Grow by a fixed number of elements, for latency bound code
+	 * that prefers many cheap reallocations to a few huge ones.
+	 */
+	template<std::size_t Step>
+	struct vector_growth_fixed {
+		static std::size_t next_capacity(std::size_t capacity, std::size_t size, std::size_t extend, std::size_t element_size) {
+			(void)size;
+			(void)element_size;
+			return capacity + std::max(Step, extend);
+		}
+	};
+
+	/**
+	 * @brief Grow by half then round the byte size up to the malloc size
+	 * class it will land in anyway (4 classes per power of two, like
+	 * jemalloc and tcmalloc), so that slack becomes usable capacity.
+	 */
+	struct vector_growth_size_class {
+		static std::size_t next_capacity(std::size_t capacity, std::size_t size, std::size_t extend, std::size_t element_size) {
+			(void)size;
+			std::size_t new_capacity = capacity + std::max(capacity / 2, extend);
+			std::size_t bytes = new_capacity * element_size;
+			if (element_size == 0 || bytes / element_size != new_capacity)
+				return new_capacity;
+			std::size_t power = 16;
+			while (power < bytes / 2 && power <= static_cast<std::size_t>(-1) / 4)
+				power *= 2;
+			std::size_t step = std::max<std::size_t>(power / 4, 16);
+			std::size_t rounded = (bytes + step - 1) / step * step;
+			if (rounded < bytes)
+				return new_capacity;
+			return rounded / element_size;
+		}
+	};
+
+	template< typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = ft::vector_growth_double >
 	class vector {
 	public:
 		typedef T													value_type;
@@ -100,6 +186,22 @@ namespace ft {
 			this->assign(x.begin(), x.end());
 		}
 
+	#if __cplusplus >= 201103L
+		/**
+		 * @brief vector move constructor (C++11 and later)
+		 * Takes x's storage, x is left empty.
+		 */
+		vector(vector&& x) noexcept :
+			_allocator(x._allocator),
+			_storage_start(x._storage_start),
+			_size(x._size),
+			_capacity(x._capacity) {
+			x._storage_start = 0;
+			x._size = 0;
+			x._capacity = 0;
+		}
+	#endif
+
 		/**
 		 * @brief vector deconstructor
 		 * The deconstructor only erases the elements, and note that if the
@@ -124,6 +226,27 @@ namespace ft {
 			return *this;
 		}
 
+	#if __cplusplus >= 201103L
+		/**
+		 * @brief vector move assignment operator (C++11 and later)
+		 * Frees the current elements and takes x's storage together with
+		 * its allocator, which has to free it. x is left empty.
+		 */
+		vector& operator=(vector&& x) noexcept {
+			if (&x == this) return *this;
+			this->destroy_from_end(this->_size);
+			this->_allocator.deallocate(this->_storage_start, this->_capacity);
+			this->_allocator = x._allocator;
+			this->_storage_start = x._storage_start;
+			this->_size = x._size;
+			this->_capacity = x._capacity;
+			x._storage_start = 0;
+			x._size = 0;
+			x._capacity = 0;
+			return *this;
+		}
+	#endif
+
 		// iterators
 
 		/**
@@ -224,6 +347,76 @@ namespace ft {
 			}
 		}
 
+		/**
+		 * @brief Resizes the vector without initializing new elements.
+		 * Same as resize() but the new elements keep whatever the memory
+		 * held, for buffers that are about to be overwritten anyway
+		 * (read(), decoders, ...).
+		 * @param n Number of elements the vector should contain.
+		 * @note Only compiles for trivially default constructible value_type
+		 * (see ft::is_trivially_default_constructible).
+		 */
+		void resize_default_init(size_type n) {
+			(void)sizeof(ft::compile_time_check<ft::is_trivially_default_constructible<value_type>::value>);
+			if (n < this->_size) {
+				this->destroy_from_end(this->_size - n);
+			} else if (n > this->_size) {
+				if (n > this->_capacity)
+					this->increase_capacity(this->get_new_size(n - this->_size, "vector: resize_default_init"));
+				this->_size = n;
+			}
+		}
+
+		/**
+		 * @brief Read up to n elements from fd straight into the free
+		 * storage at the end, no intermediate buffer. Short reads are retried
+		 * until n elements, end of file or an error.
+		 * @return number of elements appended, bytes of a trailing partial
+		 * element are read but dropped
+		 * @throw std::runtime_error if read() fails, the elements read
+		 * until then are kept.
+		 * @note Only compiles for trivially copyable value_type.
+		 */
+		size_type append_from_fd(int fd, size_type n) {
+			(void)sizeof(ft::compile_time_check<ft::is_trivially_copyable<value_type>::value>);
+			this->reserve_tail(n, "vector: append_from_fd");
+			char* tail = reinterpret_cast<char*>(this->_storage_start + this->_size);
+			std::size_t want = n * sizeof(value_type);
+			std::size_t got = 0;
+			while (got < want) {
+				ssize_t ret = ::read(fd, tail + got, want - got);
+				if (ret == 0)
+					break;
+				if (ret < 0) {
+					if (errno == EINTR)
+						continue;
+					int error = errno;
+					this->_size += got / sizeof(value_type);
+					throw std::runtime_error(std::string("vector: append_from_fd: ") + std::strerror(error));
+				}
+				got += static_cast<std::size_t>(ret);
+			}
+			this->_size += got / sizeof(value_type);
+			return got / sizeof(value_type);
+		}
+
+		/**
+		 * @brief Read up to n elements from is straight into the free storage
+		 * at the end, no intermediate buffer. Stops at end of stream, which
+		 * sets is' failbit like istream::read.
+		 * @return number of elements appended, bytes of a trailing partial
+		 * element are read but dropped
+		 * @note Only compiles for trivially copyable value_type.
+		 */
+		size_type append_from_stream(std::istream& is, size_type n) {
+			(void)sizeof(ft::compile_time_check<ft::is_trivially_copyable<value_type>::value>);
+			this->reserve_tail(n, "vector: append_from_stream");
+			is.read(reinterpret_cast<char*>(this->_storage_start + this->_size), static_cast<std::streamsize>(n * sizeof(value_type)));
+			size_type appended = static_cast<size_type>(is.gcount()) / sizeof(value_type);
+			this->_size += appended;
+			return appended;
+		}
+
 		/**
 		 * @brief Returns the total number of elements that the vector can
 		 * hold before needing to allocate more memory.
@@ -319,14 +512,20 @@ namespace ft {
 		}
 
 		void assign(size_type n, const value_type& val) {
+			if (n > this->_capacity && grows_in_place::value) {
+				// val may live in the block that is about to move
+				value_type val_copy(val);
+				this->grow_in_place(n);
+				return this->assign(n, val_copy);
+			}
 			if (n > this->_capacity)
 				this->assign_realloc(n, val);
 			else if (n > this->_size) {
-				std::fill(this->begin(), this->end(), val);
-				std::uninitialized_fill_n(this->end(), n - this->_size, val);
+				this->fill_bulk(this->_storage_start, this->_size, val);
+				this->uninitialized_fill_bulk(this->_storage_start + this->_size, n - this->_size, val);
 				this->_size = n;
 			} else {
-				std::fill_n(this->begin(), n, val);
+				this->fill_bulk(this->_storage_start, n, val);
 				this->destroy_from_end(this->_size - n);
 			}
 		}
@@ -338,6 +537,49 @@ namespace ft {
 			this->_size++;
 		}
 
+	#if __cplusplus >= 201103L
+		/**
+		 * @brief Append val by moving it (C++11 and later)
+		 */
+		void push_back(value_type&& val) {
+			this->emplace_back(std::move(val));
+		}
+
+		/**
+		 * @brief Construct a new element at the end from args (C++11 and later)
+		 * @note When the vector has to grow, the element is built first so
+		 * args may refer to elements of this vector.
+		 */
+		template<typename... Args>
+		void emplace_back(Args&&... args) {
+			if (this->_size == this->_capacity) {
+				value_type tmp(std::forward<Args>(args)...);
+				this->increase_capacity(this->get_new_size(1, "vector: emplace_back"));
+				std::allocator_traits<allocator_type>::construct(this->_allocator, this->_storage_start + this->_size, std::move_if_noexcept(tmp));
+			} else {
+				std::allocator_traits<allocator_type>::construct(this->_allocator, this->_storage_start + this->_size, std::forward<Args>(args)...);
+			}
+			this->_size++;
+		}
+
+		/**
+		 * @brief Construct a new element before position from args (C++11 and
+		 * later), the tail is rotated by moves to make room
+		 */
+		template<typename... Args>
+		iterator emplace(iterator position, Args&&... args) {
+			size_type position_idx = position - this->begin();
+			if (position_idx == this->_size) {
+				this->emplace_back(std::forward<Args>(args)...);
+			} else {
+				value_type tmp(std::forward<Args>(args)...);
+				this->emplace_back(std::move(tmp));
+				std::rotate(this->_storage_start + position_idx, this->_storage_start + this->_size - 1, this->_storage_start + this->_size);
+			}
+			return iterator(this->_storage_start + position_idx);
+		}
+	#endif
+
 		void pop_back() {
 			this->get_allocator().destroy(this->_storage_start + this->_size - 1);
 			this->_size--;
@@ -363,16 +605,30 @@ namespace ft {
 			pointer positionStart = this->_storage_start + (position - this->begin());
 			pointer end = this->_storage_start + this->_size;
 			if (position + 1 != this->end())
-				std::copy(positionStart + 1, end, positionStart);
+				this->copy_bulk(positionStart + 1, end, positionStart);
 			--this->_size;
 			this->_allocator.destroy(this->_storage_start + this->_size);
 			return position;
 		}
 
+		/**
+		 * @brief Erase position by moving the last element into it, O(1)
+		 * instead of shifting the tail. Element order is not kept.
+		 * @return iterator to the element now at position, end() if
+		 * position was the last one
+		 */
+		iterator erase_unordered(iterator position) {
+			pointer last = this->_storage_start + this->_size - 1;
+			if (position.base() != last)
+				*position = *last;
+			this->pop_back();
+			return position;
+		}
+
 		iterator erase(iterator first, iterator last) {
 			if (first == last) return first;
 			if (last != this->end())
-				std::copy(last, this->end(), first);
+				this->copy_bulk(last, this->end(), first.base());
 			this->destroy_from_end(ft::distance(first, last));
 			return first;
 		}
@@ -398,6 +654,9 @@ namespace ft {
 		}
 
 	private:
+		typedef ft::integral_constant<bool, ft::is_trivially_copyable<value_type>::value
+			&& ft::allocator_can_reallocate<allocator_type>::value>		grows_in_place;
+
 		allocator_type _allocator;
 		pointer _storage_start;
 		size_type _size;
@@ -424,6 +683,8 @@ namespace ft {
 
 		/**
 		 * @brief Range assign with forward iterator base
+		 * @note If not enough capacity and grow_in_place can reallocate, grow
+		 * first and go on as if there was enough
 		 * @note If not enough capacity: create temporary pointer and assign the
 		 * new value in there, in case of failure vector should be valid and
 		 * stay the same
@@ -434,12 +695,14 @@ namespace ft {
 		template<typename InputIterator>
 		void _assign(InputIterator first, InputIterator last, std::forward_iterator_tag) {
 			size_type len = ft::distance(first, last);
+			if (len > this->_capacity && grows_in_place::value)
+				this->grow_in_place(len);
 			if (len > this->_capacity) {
 				size_type new_capacity = len;
 				pointer new_storage_start = this->_allocator.allocate(new_capacity);
 				size_type new_size = new_capacity;
 				try {
-					std::uninitialized_copy(first, last, new_storage_start);
+					this->uninitialized_copy_bulk(first, last, new_storage_start);
 				} catch (...) {
 					this->_allocator.deallocate(new_storage_start, new_capacity);
 					throw;
@@ -453,11 +716,11 @@ namespace ft {
 			else if (len > this->_size) {
 				InputIterator mid = first;
 				std::advance(mid, this->_size);
-				std::copy(first, mid, this->_storage_start);
-				std::uninitialized_copy(mid, last, this->_storage_start + this->_size);
+				this->copy_bulk(first, mid, this->_storage_start);
+				this->uninitialized_copy_bulk(mid, last, this->_storage_start + this->_size);
 				this->_size = len;
 			} else {
-				std::copy(first, last, this->_storage_start);
+				this->copy_bulk(first, last, this->_storage_start);
 				this->destroy_from_end(this->_size - len);
 			}
 		}
@@ -474,7 +737,7 @@ namespace ft {
 			pointer new_storage_start = this->_allocator.allocate(new_capacity);
 			size_type new_size = new_capacity;
 			try {
-				std::uninitialized_fill_n(new_storage_start, new_size, val);
+				this->uninitialized_fill_bulk(new_storage_start, new_size, val);
 			} catch (...) {
 				this->_allocator.deallocate(new_storage_start, new_capacity);
 				throw;
@@ -486,19 +749,60 @@ namespace ft {
 			this->_capacity = new_capacity;
 		}
 
+		/**
+		 * @brief Make room for n more elements, growing as GrowthPolicy says
+		 */
+		void reserve_tail(size_type n, const char* s) {
+			if (this->_capacity - this->_size < n)
+				this->increase_capacity(this->get_new_size(n, s));
+		}
+
 		/**
 		 * @brief Increase the capacity of the vector with current elements
 		 * @note This doesn't check if new_capacity is within max_size
+		 * @note Trivially copyable elements with an allocator that can
+		 * reallocate skip the copy, see allocator_can_reallocate
 		 * @note This will create temporary pointer with new_capacity capacity
 		 * and copy everything over so in case of failure this will guarantee
 		 * vector will be valid and stays the same (Strong guarantee)
 		 */
 		void increase_capacity(size_type new_capacity) {
+			this->increase_capacity(new_capacity, grows_in_place());
+		}
+
+		/**
+		 * @brief Grow to new_capacity through the allocator's reallocate
+		 * when increase_capacity would, does nothing otherwise.
+		 * @note The other growth paths (insert, assign, resize) call it first
+		 * and then work in place, without it they allocate and copy.
+		 */
+		void grow_in_place(size_type new_capacity) {
+			this->grow_in_place(new_capacity, grows_in_place());
+		}
+
+		void grow_in_place(size_type new_capacity, ft::true_type) {
+			this->increase_capacity(new_capacity, ft::true_type());
+		}
+
+		void grow_in_place(size_type, ft::false_type) {}
+
+		/**
+		 * @brief Let the allocator grow the block itself (e.g. mremap), no
+		 * element is copied by the vector.
+		 * @note Allocator::reallocate leaves the block untouched on failure
+		 * (Strong guarantee)
+		 */
+		void increase_capacity(size_type new_capacity, ft::true_type) {
+			this->_storage_start = this->_allocator.reallocate(this->_storage_start, this->_capacity, new_capacity);
+			this->_capacity = new_capacity;
+		}
+
+		void increase_capacity(size_type new_capacity, ft::false_type) {
 			// Strong guarantee
 			pointer new_storage_start = this->_allocator.allocate(new_capacity);
 			size_type new_size = this->_size;
 			try {
-				std::uninitialized_copy(this->_storage_start, this->_storage_start + this->_size, new_storage_start);
+				this->uninitialized_relocate_bulk(this->_storage_start, this->_storage_start + this->_size, new_storage_start);
 			} catch (...) {
 				this->_allocator.deallocate(new_storage_start, new_capacity);
 				throw;
@@ -512,24 +816,34 @@ namespace ft {
 
 		/**
 		 * @brief Range insert with input iterator
-		 * @note If position is at the end, simply insert it one by one
-		 * @note Otherwise, create a temporary with [first, last) elements and
-		 * call insert again with random iterator
+		 * @note The elements are appended one by one then, if position is not
+		 * at the end, rotated into place (see ft::_rotate_appended). No
+		 * temporary vector is needed.
+		 * @note The appends grow the storage through GrowthPolicy like
+		 * push_back, a long range may reallocate several times.
+		 * @note If an append or the rotation buffer fails the appended
+		 * elements are destroyed (Strong guarantee), a throwing element
+		 * copy during the rotation only gives the Basic guarantee
 		 */
 		template<typename InputIterator>
 		void range_insert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag) {
-			if (position != this->end()) {
-				ft::vector<value_type> tmp;
-				tmp.assign(first, last);
-				this->insert(position, tmp.begin(), tmp.end());
-			} else {
-				for(; first != last; ++first)
+			size_type position_idx = position - this->begin();
+			size_type old_size = this->_size;
+			try {
+				for (; first != last; ++first)
 					this->push_back(*first);
+				if (position_idx != old_size)
+					ft::_rotate_appended(this->_storage_start + position_idx, this->_storage_start + old_size, this->_storage_start + this->_size, this->_allocator);
+			} catch (...) {
+				this->destroy_from_end(this->_size - old_size);
+				throw;
 			}
 		}
 
 		/**
 		 * @brief Range insert with forward iterator base
+		 * @note If not enough capacity and grow_in_place can reallocate, grow
+		 * first and go on as if there was enough
 		 * @note If not enough capacity: Create new temporary pointer and
 		 * perform copy in there, in case of failure destroy the temporary
 		 * (Strong guarantee)
@@ -545,15 +859,20 @@ namespace ft {
 		void range_insert(iterator position, InputIterator first, InputIterator last, std::forward_iterator_tag) {
 			if (first == last) return;
 			size_type n = ft::distance(first, last);
+			if (this->_capacity - this->_size < n && grows_in_place::value) {
+				size_type position_idx = ft::distance(this->begin(), position);
+				this->grow_in_place(this->get_new_size(n, "vector: range insert"));
+				position = this->begin() + position_idx;
+			}
 			if (this->_capacity - this->_size >= n) {
 				if (position != this->end()) {
 					// Basic guarantee
 					size_type position_idx = ft::distance(this->begin(), position);
-					this->relocate_safe(position_idx, position_idx + n);
-					std::copy(first, last, position);
+					this->relocate(position_idx, position_idx + n, ft::is_trivially_copyable<value_type>());
+					this->copy_bulk(first, last, position.base());
 				} else {
 					// Strong guarantee
-					std::uninitialized_copy(first, last, position);
+					this->uninitialized_copy_bulk(first, last, position.base());
 					this->_size += n;
 				}
 			} else {
@@ -563,9 +882,9 @@ namespace ft {
 				size_type new_size = 0;
 				pointer new_storage_end = NULL;
 				try {
-					new_storage_end = std::uninitialized_copy(this->_storage_start, position.base(), new_storage_start);
-					new_storage_end = std::uninitialized_copy(first, last, new_storage_end);
-					new_storage_end = std::uninitialized_copy(position.base(), this->_storage_start + this->_size, new_storage_end);
+					new_storage_end = this->uninitialized_copy_bulk(this->_storage_start, position.base(), new_storage_start);
+					new_storage_end = this->uninitialized_copy_bulk(first, last, new_storage_end);
+					new_storage_end = this->uninitialized_copy_bulk(position.base(), this->_storage_start + this->_size, new_storage_end);
 					new_size = new_storage_end - new_storage_start;
 				} catch (...) {
 					if (new_storage_end != NULL) {
@@ -584,6 +903,31 @@ namespace ft {
 			}
 		}
 
+		/**
+		 * @brief Make room for to_position - from_position elements at
+		 * from_position, the gap is left holding stale values.
+		 * @note Trivially copyable elements are shifted with one memmove,
+		 * without constructing anything in the gap.
+		 */
+		void relocate(size_type from_position, size_type to_position, ft::true_type) {
+			pointer from = this->_storage_start + from_position;
+			std::memmove(static_cast<void*>(this->_storage_start + to_position), static_cast<const void*>(from), (this->_size - from_position) * sizeof(value_type));
+			this->_size += to_position - from_position;
+		}
+
+		void relocate(size_type from_position, size_type to_position, ft::false_type) {
+			this->relocate_safe(from_position, to_position);
+		}
+
+		void relocate(size_type from_position, size_type to_position, const value_type& default_val, ft::true_type) {
+			(void)default_val;
+			this->relocate(from_position, to_position, ft::true_type());
+		}
+
+		void relocate(size_type from_position, size_type to_position, const value_type& default_val, ft::false_type) {
+			this->relocate_safe(from_position, to_position, default_val);
+		}
+
 		/**
 		 * @brief Move every elements backward from from_position to the new
 		 * to_position safely
@@ -612,7 +956,7 @@ namespace ft {
 		}
 
 		/**
-		 * @brief Get new size to extend vector
+		 * @brief Get new size to extend vector, as chosen by GrowthPolicy
 		 * @param size_to_extend size to extend the vector
 		 * @param s string to add trace where this could be called from
 		 * @exception length_error if desired new size is bigger than max size
@@ -621,13 +965,17 @@ namespace ft {
 			if (this->max_size() - this->_size < size_to_extend)
 				throw std::length_error(s);
 
-			// size_type new_size = this->_size + std::max(this->_size, size_to_extend); // gcc
-			size_type new_size = this->_capacity + std::max(this->_capacity, size_to_extend); // clang
+			size_type needed = this->_size + size_to_extend;
+			size_type new_size = GrowthPolicy::next_capacity(this->_capacity, this->_size, size_to_extend, sizeof(value_type));
+			if (new_size < needed)
+				new_size = needed;
 			return new_size > this->max_size() ? this->max_size() : new_size;
 		}
 
 		/**
 		 * @brief Fill insert
+		 * @note If not enough capacity and grow_in_place can reallocate, grow
+		 * first and go on as if there was enough
 		 * @note If not enough capacity: Create new temporary pointer and
 		 * perform copy in there, in case of failure destroy the temporary
 		 * (Strong guarantee)
@@ -641,15 +989,22 @@ namespace ft {
 		 */
 		void _insert(iterator position, size_type n, const value_type& val) {
 			if (n == 0) return;
+			if (this->_capacity - this->_size < n && grows_in_place::value) {
+				// val may live in the block that is about to move
+				value_type val_copy(val);
+				size_type position_idx = ft::distance(this->begin(), position);
+				this->grow_in_place(this->get_new_size(n, "vector: _insert"));
+				return this->_insert(this->begin() + position_idx, n, val_copy);
+			}
 			if (this->_capacity - this->_size >= n) {
 				if (position != this->end()) {
 					// Basic guarantee
 					size_type position_idx = ft::distance(this->begin(), position);
-					this->relocate_safe(position_idx, position_idx + n, val);
-					std::fill_n(position, n, val);
+					this->relocate(position_idx, position_idx + n, val, ft::is_trivially_copyable<value_type>());
+					std::fill_n(position.base(), n, val);
 				} else {
 					// Strong guarantee
-					std::uninitialized_fill_n(this->_storage_start + this->_size, n, val);
+					this->uninitialized_fill_bulk(this->_storage_start + this->_size, n, val);
 					this->_size += n;
 				}
 			} else {
@@ -659,10 +1014,10 @@ namespace ft {
 				size_type new_size = 0;
 				pointer new_storage_end = NULL;
 				try {
-					new_storage_end = std::uninitialized_copy(this->_storage_start, position.base(), new_storage_start);
-					std::uninitialized_fill_n(new_storage_end, n, val);
+					new_storage_end = this->uninitialized_copy_bulk(this->_storage_start, position.base(), new_storage_start);
+					this->uninitialized_fill_bulk(new_storage_end, n, val);
 					new_storage_end += n;
-					new_storage_end = std::uninitialized_copy(position.base(), this->_storage_start + this->_size, new_storage_end);
+					new_storage_end = this->uninitialized_copy_bulk(position.base(), this->_storage_start + this->_size, new_storage_end);
 					new_size = new_storage_end - new_storage_start;
 				} catch (...) {
 					if (new_storage_end != NULL) {
@@ -681,13 +1036,146 @@ namespace ft {
 			}
 		}
 
+		/**
+		 * @brief std::uninitialized_copy that becomes a single memcpy when
+		 * the source is contiguous storage of value_type (any contiguous
+		 * iterator, see ft::unwrap_iterator) and value_type is trivially
+		 * copyable (see ft::is_trivially_copyable).
+		 * @note Source and destination must not overlap.
+		 */
+		template<typename InputIterator>
+		static pointer uninitialized_copy_bulk(InputIterator first, InputIterator last, pointer dest) {
+			return vector::uninitialized_copy_unwrapped(ft::unwrap_iterator(first), ft::unwrap_iterator(last), dest);
+		}
+
+		template<typename InputIterator>
+		static pointer uninitialized_copy_unwrapped(InputIterator first, InputIterator last, pointer dest) {
+			return std::uninitialized_copy(first, last, dest);
+		}
+
+		static pointer uninitialized_copy_unwrapped(const_pointer first, const_pointer last, pointer dest) {
+			return vector::uninitialized_copy_contiguous(first, last, dest, ft::is_trivially_copyable<value_type>());
+		}
+
+		static pointer uninitialized_copy_unwrapped(pointer first, pointer last, pointer dest) {
+			return vector::uninitialized_copy_unwrapped(const_pointer(first), const_pointer(last), dest);
+		}
+
+		static pointer uninitialized_copy_contiguous(const_pointer first, const_pointer last, pointer dest, ft::true_type) {
+			if (first != last)
+				ft::_bulk_copy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			return dest + (last - first);
+		}
+
+		static pointer uninitialized_copy_contiguous(const_pointer first, const_pointer last, pointer dest, ft::false_type) {
+			return std::uninitialized_copy(first, last, dest);
+		}
+
+		/**
+		 * @brief uninitialized_copy_bulk for reallocation, the source is
+		 * destroyed right after. In C++11 and later elements with a noexcept
+		 * move constructor are moved instead, so the strong guarantee holds.
+		 */
+		static pointer uninitialized_relocate_bulk(pointer first, pointer last, pointer dest) {
+		#if __cplusplus >= 201103L
+			return vector::uninitialized_relocate_bulk(first, last, dest, ft::integral_constant<bool,
+				std::is_nothrow_move_constructible<value_type>::value && !ft::is_trivially_copyable<value_type>::value>());
+		#else
+			return vector::uninitialized_copy_bulk(first, last, dest);
+		#endif
+		}
+
+	#if __cplusplus >= 201103L
+		static pointer uninitialized_relocate_bulk(pointer first, pointer last, pointer dest, ft::true_type) {
+			return std::uninitialized_copy(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+		}
+
+		static pointer uninitialized_relocate_bulk(pointer first, pointer last, pointer dest, ft::false_type) {
+			return vector::uninitialized_copy_bulk(first, last, dest);
+		}
+	#endif
+
+		/**
+		 * @brief std::uninitialized_fill_n, trivially copyable elements are
+		 * plain stores so big fills can be split over threads (see
+		 * ft::set_bulk_parallelism).
+		 */
+		static void uninitialized_fill_bulk(pointer dest, size_type n, const value_type& val) {
+			vector::uninitialized_fill_bulk(dest, n, val, ft::is_trivially_copyable<value_type>());
+		}
+
+		static void uninitialized_fill_bulk(pointer dest, size_type n, const value_type& val, ft::true_type) {
+			ft::_bulk_fill(dest, n, val);
+		}
+
+		static void uninitialized_fill_bulk(pointer dest, size_type n, const value_type& val, ft::false_type) {
+			std::uninitialized_fill_n(dest, n, val);
+		}
+
+		/**
+		 * @brief std::fill_n onto constructed elements, same dispatch as
+		 * uninitialized_fill_bulk.
+		 */
+		static void fill_bulk(pointer dest, size_type n, const value_type& val) {
+			vector::fill_bulk(dest, n, val, ft::is_trivially_copyable<value_type>());
+		}
+
+		static void fill_bulk(pointer dest, size_type n, const value_type& val, ft::true_type) {
+			ft::_bulk_fill(dest, n, val);
+		}
+
+		static void fill_bulk(pointer dest, size_type n, const value_type& val, ft::false_type) {
+			std::fill_n(dest, n, val);
+		}
+
+		/**
+		 * @brief std::copy onto constructed elements, a single memmove under
+		 * the same conditions as uninitialized_copy_bulk.
+		 */
+		template<typename InputIterator>
+		static pointer copy_bulk(InputIterator first, InputIterator last, pointer dest) {
+			return vector::copy_unwrapped(ft::unwrap_iterator(first), ft::unwrap_iterator(last), dest);
+		}
+
+		template<typename InputIterator>
+		static pointer copy_unwrapped(InputIterator first, InputIterator last, pointer dest) {
+			return std::copy(first, last, dest);
+		}
+
+		static pointer copy_unwrapped(const_pointer first, const_pointer last, pointer dest) {
+			return vector::copy_contiguous(first, last, dest, ft::is_trivially_copyable<value_type>());
+		}
+
+		static pointer copy_unwrapped(pointer first, pointer last, pointer dest) {
+			return vector::copy_unwrapped(const_pointer(first), const_pointer(last), dest);
+		}
+
+		static pointer copy_contiguous(const_pointer first, const_pointer last, pointer dest, ft::true_type) {
+			if (first != last)
+				std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			return dest + (last - first);
+		}
+
+		static pointer copy_contiguous(const_pointer first, const_pointer last, pointer dest, ft::false_type) {
+			return std::copy(first, last, dest);
+		}
+
 		/**
 		 * @brief Destroy n amounts of element from end of storage
 		 * @param n size of elements to destroy
 		 * @note If n equal size of vector, this destroy all elements.
 		 * @note If n bigger than size of vector this causes undefined behaviour.
+		 * @note O(1) for trivially destructible elements, only the size moves.
 		 */
 		void destroy_from_end(size_type n) {
+			this->destroy_from_end(n, ft::is_trivially_destructible<value_type>());
+		}
+
+		void destroy_from_end(size_type n, ft::true_type) {
+			this->_size -= n;
+		}
+
+		void destroy_from_end(size_type n, ft::false_type) {
 			for (size_type i = this->_size - 1; n > 0; --i, --n) {
 				this->_allocator.destroy(this->_storage_start + i);
 				this->_size--;
@@ -695,42 +1183,62 @@ namespace ft {
 		}
 	};
 
-	template<typename T, typename Alloc>
-	bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+	/**
+	 * @brief Erase every element for which pred is true in a single pass,
+	 * survivors are compacted toward the front in order then the tail is
+	 * destroyed at once. pred is called once per element.
+	 * @return number of elements erased
+	 */
+	template<typename T, typename Alloc, typename Growth, typename Predicate>
+	typename vector<T, Alloc, Growth>::size_type erase_if(vector<T, Alloc, Growth>& c, Predicate pred) {
+		typedef typename vector<T, Alloc, Growth>::size_type size_type;
+		if (c.empty())
+			return 0;
+		T* first = &c[0];
+		T* last = std::remove_if(first, first + c.size(), pred);
+		size_type removed = (first + c.size()) - last;
+		c.erase(c.begin() + (last - first), c.end());
+		return removed;
+	}
+
+	template<typename T, typename Alloc, typename Growth>
+	bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		if (lhs.size() == rhs.size())
 			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		return false;
 	}
 
-	template<typename T, typename Alloc>
-	bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+	template<typename T, typename Alloc, typename Growth>
+	bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		return !(lhs == rhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+	template<typename T, typename Alloc, typename Growth>
+	bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<=(const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+	template<typename T, typename Alloc, typename Growth>
+	bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		return !(rhs < lhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+	template<typename T, typename Alloc, typename Growth>
+	bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		return rhs < lhs;
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+	template<typename T, typename Alloc, typename Growth>
+	bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 		return !(lhs < rhs);
 	}
 }
 
 namespace std {
-	template<typename T, typename Alloc>
-	void swap(ft::vector<T, Alloc>& x, ft::vector<T, Alloc>& y) {
+	template<typename T, typename Alloc, typename Growth>
+	void swap(ft::vector<T, Alloc, Growth>& x, ft::vector<T, Alloc, Growth>& y) {
 		x.swap(y);
 	}
 }
+
+#include "vector_bool.hpp"
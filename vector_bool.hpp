@@ -0,0 +1,754 @@
+#pragma once
+
+#include "vector.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+
+namespace ft {
+	// Word kernels for the packed vector<bool>. Counting uses the popcnt
+	// instruction when the cpu has it, and/or/xor run on SSE2 or AVX2
+	// registers, both picked at runtime like the _mismatch kernels.
+
+	inline std::size_t _popcount_word(bit_word word) {
+	#ifdef __GNUC__
+		return __builtin_popcountl(word);
+	#else
+		std::size_t count = 0;
+		for (; word != 0; word &= word - 1)
+			++count;
+		return count;
+	#endif
+	}
+
+	inline std::size_t _lowest_bit(bit_word word) {
+	#ifdef __GNUC__
+		return __builtin_ctzl(word);
+	#else
+		std::size_t i = 0;
+		for (; (word & 1) == 0; word >>= 1)
+			++i;
+		return i;
+	#endif
+	}
+
+	inline std::size_t _popcount_scalar(const bit_word* words, std::size_t n) {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			count += ft::_popcount_word(words[i]);
+		return count;
+	}
+
+#ifdef FT_SIMD_X86
+	inline bool _cpu_has_popcnt() {
+		static const bool has_popcnt = __builtin_cpu_supports("popcnt");
+		return has_popcnt;
+	}
+
+	__attribute__((target("popcnt")))
+	inline std::size_t _popcount_popcnt(const bit_word* words, std::size_t n) {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			count += __builtin_popcountl(words[i]);
+		return count;
+	}
+#endif
+
+	inline std::size_t _popcount(const bit_word* words, std::size_t n) {
+	#ifdef FT_SIMD_X86
+		if (ft::_cpu_has_popcnt())
+			return ft::_popcount_popcnt(words, n);
+	#endif
+		return ft::_popcount_scalar(words, n);
+	}
+
+	struct _bit_and {
+		static bit_word apply(bit_word a, bit_word b) { return a & b; }
+	#ifdef FT_SIMD_X86
+		static __m128i apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+		__attribute__((target("avx2")))
+		static __m256i apply(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+	#endif
+	};
+
+	struct _bit_or {
+		static bit_word apply(bit_word a, bit_word b) { return a | b; }
+	#ifdef FT_SIMD_X86
+		static __m128i apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+		__attribute__((target("avx2")))
+		static __m256i apply(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+	#endif
+	};
+
+	struct _bit_xor {
+		static bit_word apply(bit_word a, bit_word b) { return a ^ b; }
+	#ifdef FT_SIMD_X86
+		static __m128i apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+		__attribute__((target("avx2")))
+		static __m256i apply(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+	#endif
+	};
+
+	template<typename Op>
+	void _bitwise_scalar(bit_word* dest, const bit_word* src, std::size_t i, std::size_t n) {
+		for (; i < n; ++i)
+			dest[i] = Op::apply(dest[i], src[i]);
+	}
+
+#ifdef FT_SIMD_X86
+	template<typename Op>
+	void _bitwise_sse2(bit_word* dest, const bit_word* src, std::size_t n) {
+		unsigned char* d = reinterpret_cast<unsigned char*>(dest);
+		const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+		std::size_t bytes = n * sizeof(bit_word);
+		std::size_t i = 0;
+		for (; i + 16 <= bytes; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), Op::apply(x, y));
+		}
+		ft::_bitwise_scalar<Op>(dest, src, i / sizeof(bit_word), n);
+	}
+
+	template<typename Op>
+	__attribute__((target("avx2")))
+	void _bitwise_avx2(bit_word* dest, const bit_word* src, std::size_t n) {
+		unsigned char* d = reinterpret_cast<unsigned char*>(dest);
+		const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+		std::size_t bytes = n * sizeof(bit_word);
+		std::size_t i = 0;
+		for (; i + 32 <= bytes; i += 32) {
+			__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + i));
+			__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), Op::apply(x, y));
+		}
+		ft::_bitwise_scalar<Op>(dest, src, i / sizeof(bit_word), n);
+	}
+#endif
+
+	/**
+	 * @brief dest[i] = Op(dest[i], src[i]) for the first n words
+	 */
+	template<typename Op>
+	void _bitwise(bit_word* dest, const bit_word* src, std::size_t n) {
+	#ifdef FT_SIMD_X86
+		if (ft::_cpu_has_avx2())
+			return ft::_bitwise_avx2<Op>(dest, src, n);
+		return ft::_bitwise_sse2<Op>(dest, src, n);
+	#else
+		ft::_bitwise_scalar<Op>(dest, src, 0, n);
+	#endif
+	}
+
+	/**
+	 * @brief Packed vector<bool>, one bit per element in unsigned long words.
+	 * Same interface as vector except that references are bit_reference
+	 * proxies and there is no data(). Adds word-wide count(), find_first(),
+	 * find_next() and &=, |=, ^= between vectors.
+	 * @note Bits past size() are always kept zero, count() and operator==
+	 * rely on it.
+	 */
+	template<typename Allocator, typename GrowthPolicy>
+	class vector<bool, Allocator, GrowthPolicy> {
+	public:
+		typedef bool												value_type;
+		typedef Allocator											allocator_type;
+		typedef ft::bit_reference									reference;
+		typedef bool												const_reference;
+		typedef ft::bit_iterator<reference, bit_word*>				iterator;
+		typedef ft::bit_iterator<const_reference, const bit_word*>	const_iterator;
+		typedef typename iterator::pointer							pointer;
+		typedef typename const_iterator::pointer					const_pointer;
+		typedef ft::rai_reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::rai_reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t										difference_type;
+		typedef std::size_t											size_type;
+		typedef ft::bit_word										word_type;
+
+	private:
+		typedef typename Allocator::template rebind<word_type>::other	word_allocator_type;
+
+	public:
+		// construct/copy/destroy
+
+		explicit vector(const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_words(0),
+			_size(0),
+			_word_capacity(0) { }
+
+		explicit vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_allocator(alloc),
+			_words(0),
+			_size(0),
+			_word_capacity(0) {
+			this->assign(n, val);
+		}
+
+		template<typename InputIterator>
+		vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::iterator_traits<InputIterator>::iterator_category* = 0) :
+			_allocator(alloc),
+			_words(0),
+			_size(0),
+			_word_capacity(0) {
+			try {
+				this->assign(first, last);
+			} catch (...) {
+				this->release();
+				throw;
+			}
+		}
+
+		vector(const vector& x) :
+			_allocator(x._allocator),
+			_words(0),
+			_size(0),
+			_word_capacity(0) {
+			if (x._size == 0) return;
+			this->reallocate(vector::wordsFor(x._size));
+			std::memcpy(this->_words, x._words, vector::wordsFor(x._size) * sizeof(word_type));
+			this->_size = x._size;
+		}
+
+	#if __cplusplus >= 201103L
+		vector(vector&& x) noexcept :
+			_allocator(x._allocator),
+			_words(x._words),
+			_size(x._size),
+			_word_capacity(x._word_capacity) {
+			x._words = 0;
+			x._size = 0;
+			x._word_capacity = 0;
+		}
+	#endif
+
+		~vector() {
+			this->release();
+		}
+
+		vector& operator=(const vector& x) {
+			if (&x == this) return *this;
+			size_type words = vector::wordsFor(x._size);
+			if (words > this->_word_capacity) {
+				vector tmp(x);
+				this->swap(tmp);
+				return *this;
+			}
+			this->clear();
+			if (words != 0)
+				std::memcpy(this->_words, x._words, words * sizeof(word_type));
+			this->_size = x._size;
+			return *this;
+		}
+
+	#if __cplusplus >= 201103L
+		vector& operator=(vector&& x) noexcept {
+			if (&x == this) return *this;
+			this->release();
+			this->_allocator = x._allocator;
+			this->_words = x._words;
+			this->_size = x._size;
+			this->_word_capacity = x._word_capacity;
+			x._words = 0;
+			x._size = 0;
+			x._word_capacity = 0;
+			return *this;
+		}
+	#endif
+
+		// iterators
+
+		iterator begin() {
+			return iterator(this->_words, 0);
+		}
+
+		const_iterator begin() const {
+			return const_iterator(this->_words, 0);
+		}
+
+		iterator end() {
+			return this->begin() + this->_size;
+		}
+
+		const_iterator end() const {
+			return this->begin() + this->_size;
+		}
+
+		reverse_iterator rbegin() {
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const {
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend() {
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const {
+			return const_reverse_iterator(this->begin());
+		}
+
+		// capacity
+
+		size_type size() const {
+			return this->_size;
+		}
+
+		size_type max_size() const {
+			size_type words = word_allocator_type(this->_allocator).max_size();
+			size_type limit = static_cast<size_type>(-1) / 2;
+			return words > limit / ft::bit_word_size() ? limit : words * ft::bit_word_size();
+		}
+
+		void resize(size_type n, value_type val = value_type()) {
+			if (n < this->_size)
+				this->erase(this->begin() + n, this->end());
+			else if (n > this->_size)
+				this->insert(this->end(), n - this->_size, val);
+		}
+
+		size_type capacity() const {
+			return this->_word_capacity * ft::bit_word_size();
+		}
+
+		bool empty() const {
+			return this->_size == 0;
+		}
+
+		/**
+		 * @brief Make room for n bits.
+		 * @throw std::length_error if n exceeds max_size().
+		 */
+		void reserve(size_type n) {
+			if (n > this->max_size())
+				throw std::length_error("vector<bool>: reserve");
+			if (n > this->capacity())
+				this->reallocate(vector::wordsFor(n));
+		}
+
+		// element access
+
+		reference operator[](size_type n) {
+			return *(this->begin() + n);
+		}
+
+		const_reference operator[](size_type n) const {
+			return *(this->begin() + n);
+		}
+
+		reference at(size_type n) {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return (*this)[n];
+		}
+
+		const_reference at(size_type n) const {
+			if (n >= this->size())
+				throw std::out_of_range("out of range");
+			return (*this)[n];
+		}
+
+		reference front() {
+			return *this->begin();
+		}
+
+		const_reference front() const {
+			return *this->begin();
+		}
+
+		reference back() {
+			return *(this->end() - 1);
+		}
+
+		const_reference back() const {
+			return *(this->end() - 1);
+		}
+
+		/**
+		 * @brief The packed words, bit i is (words()[i / bits] >> (i % bits)) & 1
+		 * with bits = ft::bit_word_size(). Bits past size() are zero.
+		 */
+		const word_type* words() const {
+			return this->_words;
+		}
+
+		// bit operations
+
+		/**
+		 * @brief Number of set bits, one popcount per word
+		 */
+		size_type count() const {
+			return ft::_popcount(this->_words, vector::wordsFor(this->_size));
+		}
+
+		/**
+		 * @brief Index of the first set bit, size() if none
+		 */
+		size_type find_first() const {
+			return this->findFrom(0);
+		}
+
+		/**
+		 * @brief Index of the first set bit after pos, size() if none
+		 */
+		size_type find_next(size_type pos) const {
+			if (pos + 1 >= this->_size)
+				return this->_size;
+			return this->findFrom(pos + 1);
+		}
+
+		/**
+		 * @brief Bitwise and with x word by word, bits past x.size() count
+		 * as zero. size() is unchanged.
+		 */
+		vector& operator&=(const vector& x) {
+			size_type common = this->commonWords(x);
+			ft::_bitwise<ft::_bit_and>(this->_words, x._words, common);
+			size_type words = vector::wordsFor(this->_size);
+			if (words > common)
+				std::memset(this->_words + common, 0, (words - common) * sizeof(word_type));
+			return *this;
+		}
+
+		/**
+		 * @brief Bitwise or with x word by word, bits past x.size() count
+		 * as zero. size() is unchanged.
+		 */
+		vector& operator|=(const vector& x) {
+			ft::_bitwise<ft::_bit_or>(this->_words, x._words, this->commonWords(x));
+			this->clearTail();
+			return *this;
+		}
+
+		/**
+		 * @brief Bitwise xor with x word by word, bits past x.size() count
+		 * as zero. size() is unchanged.
+		 */
+		vector& operator^=(const vector& x) {
+			ft::_bitwise<ft::_bit_xor>(this->_words, x._words, this->commonWords(x));
+			this->clearTail();
+			return *this;
+		}
+
+		/**
+		 * @brief Invert every bit
+		 */
+		void flip() {
+			size_type words = vector::wordsFor(this->_size);
+			for (size_type i = 0; i < words; ++i)
+				this->_words[i] = ~this->_words[i];
+			this->clearTail();
+		}
+
+		// modifiers
+
+		template<typename InputIterator>
+		void assign(InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type& val) {
+			this->clear();
+			this->insert(this->end(), n, val);
+		}
+
+		void push_back(const value_type& val) {
+			if (this->_size == this->capacity())
+				this->reallocate(this->getNewWords(1, "vector<bool>: push_back"));
+			if (val)
+				this->_words[this->_size / ft::bit_word_size()] |= vector::maskOf(this->_size);
+			this->_size++;
+		}
+
+		void pop_back() {
+			this->_size--;
+			this->_words[this->_size / ft::bit_word_size()] &= ~vector::maskOf(this->_size);
+		}
+
+		iterator insert(iterator position, const value_type& val) {
+			size_type position_idx = position - this->begin();
+			this->insert(position, 1, val);
+			return this->begin() + position_idx;
+		}
+
+		/**
+		 * @brief Fill insert, whole words are set with memset
+		 * @exception Strong guarantee, only allocation can throw
+		 */
+		void insert(iterator position, size_type n, const value_type& val) {
+			if (n == 0) return;
+			size_type position_idx = position - this->begin();
+			this->openGap(position_idx, n, "vector<bool>: insert");
+			this->fillBits(position_idx, position_idx + n, val);
+		}
+
+		template<typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last, typename ft::iterator_traits<InputIterator>::iterator_category* = 0) {
+			typedef typename ft::iterator_traits<InputIterator>::iterator_category iterator_category;
+			this->range_insert(position - this->begin(), first, last, iterator_category());
+		}
+
+		iterator erase(iterator position) {
+			return this->erase(position, position + 1);
+		}
+
+		/**
+		 * @brief The bits after last are moved down a word at a time (see
+		 * moveBits) and the freed tail is zeroed
+		 */
+		iterator erase(iterator first, iterator last) {
+			if (first == last) return first;
+			size_type first_idx = first - this->begin();
+			size_type last_idx = last - this->begin();
+			size_type new_size = this->_size - (last_idx - first_idx);
+			this->moveBits(first_idx, last_idx, this->_size - last_idx);
+			this->fillBits(new_size, this->_size, false);
+			this->_size = new_size;
+			return this->begin() + first_idx;
+		}
+
+		void swap(vector& x) {
+			if (this == &x) return;
+			std::swap(this->_words, x._words);
+			std::swap(this->_size, x._size);
+			std::swap(this->_word_capacity, x._word_capacity);
+		}
+
+		static void swap(reference x, reference y) {
+			ft::swap(x, y);
+		}
+
+		void clear() {
+			if (this->_size != 0)
+				std::memset(this->_words, 0, vector::wordsFor(this->_size) * sizeof(word_type));
+			this->_size = 0;
+		}
+
+		// allocator
+
+		allocator_type get_allocator() const {
+			return allocator_type(this->_allocator);
+		}
+
+	private:
+		allocator_type _allocator;
+		word_type* _words;
+		size_type _size;
+		size_type _word_capacity;
+
+		static size_type wordsFor(size_type bits) {
+			return (bits + ft::bit_word_size() - 1) / ft::bit_word_size();
+		}
+
+		static word_type maskOf(size_type bit) {
+			return word_type(1) << (bit % ft::bit_word_size());
+		}
+
+		size_type commonWords(const vector& x) const {
+			return std::min(vector::wordsFor(this->_size), vector::wordsFor(x._size));
+		}
+
+		/**
+		 * @brief Zero the bits of the last word past size()
+		 */
+		void clearTail() {
+			size_type used = this->_size % ft::bit_word_size();
+			if (used != 0)
+				this->_words[this->_size / ft::bit_word_size()] &= vector::maskOf(used) - 1;
+		}
+
+		size_type findFrom(size_type pos) const {
+			size_type word_idx = pos / ft::bit_word_size();
+			size_type words = vector::wordsFor(this->_size);
+			if (word_idx >= words)
+				return this->_size;
+			word_type word = this->_words[word_idx] & ~(vector::maskOf(pos) - 1);
+			while (word == 0) {
+				if (++word_idx == words)
+					return this->_size;
+				word = this->_words[word_idx];
+			}
+			return word_idx * ft::bit_word_size() + ft::_lowest_bit(word);
+		}
+
+		/**
+		 * @brief Set bits [first, last) to val, partial words are masked and
+		 * whole words are memset
+		 */
+		void fillBits(size_type first, size_type last, bool val) {
+			if (first >= last) return;
+			size_type first_word = first / ft::bit_word_size();
+			size_type last_word = (last - 1) / ft::bit_word_size();
+			word_type head = ~(vector::maskOf(first) - 1);
+			word_type tail = last % ft::bit_word_size() == 0 ? ~word_type(0) : vector::maskOf(last) - 1;
+			if (first_word == last_word) {
+				this->setMasked(first_word, head & tail, val);
+				return;
+			}
+			this->setMasked(first_word, head, val);
+			if (last_word - first_word > 1)
+				std::memset(this->_words + first_word + 1, val ? 0xFF : 0, (last_word - first_word - 1) * sizeof(word_type));
+			this->setMasked(last_word, tail, val);
+		}
+
+		void setMasked(size_type word_idx, word_type mask, bool val) {
+			if (val)
+				this->_words[word_idx] |= mask;
+			else
+				this->_words[word_idx] &= ~mask;
+		}
+
+		/**
+		 * @brief Read count bits (1 to a word) starting at pos, the low bit
+		 * of the result is bit pos
+		 */
+		word_type readBits(size_type pos, size_type count) const {
+			size_type word_idx = pos / ft::bit_word_size();
+			size_type offset = pos % ft::bit_word_size();
+			word_type bits = this->_words[word_idx] >> offset;
+			if (offset != 0 && offset + count > ft::bit_word_size())
+				bits |= this->_words[word_idx + 1] << (ft::bit_word_size() - offset);
+			if (count < ft::bit_word_size())
+				bits &= vector::maskOf(count) - 1;
+			return bits;
+		}
+
+		/**
+		 * @brief Write the low count bits (1 to a word) of bits at pos, the
+		 * other bits of the one or two words touched are kept
+		 */
+		void writeBits(size_type pos, size_type count, word_type bits) {
+			size_type word_idx = pos / ft::bit_word_size();
+			size_type offset = pos % ft::bit_word_size();
+			word_type mask = count < ft::bit_word_size() ? vector::maskOf(count) - 1 : ~word_type(0);
+			this->_words[word_idx] = (this->_words[word_idx] & ~(mask << offset)) | (bits << offset);
+			if (offset != 0 && offset + count > ft::bit_word_size()) {
+				size_type carry = ft::bit_word_size() - offset;
+				this->_words[word_idx + 1] = (this->_words[word_idx + 1] & ~(mask >> carry)) | (bits >> carry);
+			}
+		}
+
+		/**
+		 * @brief memmove for bits: move count bits from from to to a word at
+		 * a time, each word is shifted into place with the carry from its
+		 * neighbour. Overlapping ranges are walked in the safe direction.
+		 */
+		void moveBits(size_type to, size_type from, size_type count) {
+			const size_type word_bits = ft::bit_word_size();
+			if (to < from) {
+				for (size_type done = 0; done < count; done += word_bits) {
+					size_type chunk = std::min(word_bits, count - done);
+					this->writeBits(to + done, chunk, this->readBits(from + done, chunk));
+				}
+			} else if (to > from) {
+				for (size_type left = count; left > 0;) {
+					size_type chunk = std::min(word_bits, left);
+					left -= chunk;
+					this->writeBits(to + left, chunk, this->readBits(from + left, chunk));
+				}
+			}
+		}
+
+		/**
+		 * @brief Make room for n bits at position_idx, the bits after it are
+		 * shifted up a word at a time (see moveBits). The gap is left with
+		 * unspecified values.
+		 */
+		void openGap(size_type position_idx, size_type n, const char* s) {
+			if (this->capacity() - this->_size < n)
+				this->reallocate(this->getNewWords(n, s));
+			this->moveBits(position_idx + n, position_idx, this->_size - position_idx);
+			this->_size += n;
+		}
+
+		template<typename InputIterator>
+		void range_insert(size_type position_idx, InputIterator first, InputIterator last, std::input_iterator_tag) {
+			size_type old_size = this->_size;
+			for (; first != last; ++first)
+				this->push_back(*first);
+			if (position_idx != old_size)
+				std::rotate(this->begin() + position_idx, this->begin() + old_size, this->end());
+		}
+
+		template<typename ForwardIterator>
+		void range_insert(size_type position_idx, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+			size_type n = ft::distance(first, last);
+			if (n == 0) return;
+			this->openGap(position_idx, n, "vector<bool>: range insert");
+			std::copy(first, last, this->begin() + position_idx);
+		}
+
+		/**
+		 * @brief Word count to grow to for n more bits, as chosen by GrowthPolicy
+		 * @exception length_error if the new size is bigger than max size
+		 */
+		size_type getNewWords(size_type n, const char* s) {
+			if (this->max_size() - this->_size < n)
+				throw std::length_error(s);
+			size_type needed = vector::wordsFor(this->_size + n);
+			size_type words = GrowthPolicy::next_capacity(this->_word_capacity, vector::wordsFor(this->_size),
+				needed - this->_word_capacity, sizeof(word_type));
+			return words < needed ? needed : words;
+		}
+
+		/**
+		 * @brief Move the words to a buffer of new_words, the new words are zeroed
+		 */
+		void reallocate(size_type new_words) {
+			word_allocator_type word_allocator(this->_allocator);
+			word_type* new_storage = word_allocator.allocate(new_words);
+			size_type used = vector::wordsFor(this->_size);
+			if (used != 0)
+				std::memcpy(new_storage, this->_words, used * sizeof(word_type));
+			std::memset(new_storage + used, 0, (new_words - used) * sizeof(word_type));
+			if (this->_words != 0)
+				word_allocator.deallocate(this->_words, this->_word_capacity);
+			this->_words = new_storage;
+			this->_word_capacity = new_words;
+		}
+
+		void release() {
+			if (this->_words != 0)
+				word_allocator_type(this->_allocator).deallocate(this->_words, this->_word_capacity);
+			this->_words = 0;
+			this->_size = 0;
+			this->_word_capacity = 0;
+		}
+	};
+
+	template<typename Alloc, typename Growth>
+	bool operator==(const vector<bool, Alloc, Growth>& lhs, const vector<bool, Alloc, Growth>& rhs) {
+		if (lhs.size() != rhs.size())
+			return false;
+		std::size_t words = (lhs.size() + ft::bit_word_size() - 1) / ft::bit_word_size();
+		return words == 0 || std::memcmp(lhs.words(), rhs.words(), words * sizeof(bit_word)) == 0;
+	}
+
+	/**
+	 * @brief erase_if for the packed vector<bool>, survivors are copied down
+	 * bit by bit in one pass
+	 * @return number of elements erased
+	 */
+	template<typename Alloc, typename Growth, typename Predicate>
+	typename vector<bool, Alloc, Growth>::size_type erase_if(vector<bool, Alloc, Growth>& c, Predicate pred) {
+		typedef typename vector<bool, Alloc, Growth>::iterator iterator;
+		iterator out = c.begin();
+		for (iterator it = c.begin(); it != c.end(); ++it) {
+			bool val = *it;
+			if (!pred(val))
+				*out++ = val;
+		}
+		typename vector<bool, Alloc, Growth>::size_type removed = c.end() - out;
+		c.erase(out, c.end());
+		return removed;
+	}
+}